@@ -22,7 +22,7 @@
 
 #include <SparkyStudios/Audio/Amplitude/Core/Common.h>
 
-#include <SparkyStudios/Audio/Amplitude/Math/FFT.h>
+typedef struct PFFFT_Setup PFFFT_Setup;
 
 namespace SparkyStudios::Audio::Amplitude::Convolution
 {
@@ -40,6 +40,9 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
      *   processing time, of course), i.e. the output always is the convolved
      *   input for each processing call.
      *
+     * - The spectra of the impulse response and of the input are stored in the
+     *   internal layout of PFFFT, and multiplied with its vectorized routines.
+     *
      * - The convolver is suitable for real-time processing which means that no
      *   "unpredictable" operations like allocations, locking, API calls, etc. are
      *   performed during processing (all necessary allocations and preparations take
@@ -66,6 +69,18 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
          */
         bool Init(AmSize blockSize, const AmAudioSample* ir, AmSize irLen);
 
+        /**
+         * @brief Initializes the convolver with the impulse response of another convolver
+         *
+         * The spectra of the impulse response are shared instead of computed again, so the
+         * prototype must outlive this convolver. Only the buffers of the input are allocated.
+         *
+         * @param prototype The convolver to share the impulse response with
+         *
+         * @return true: Success - false: Failed
+         */
+        bool Init(const Convolver& prototype);
+
         /**
          * @brief Convolves the the given input samples and immediately outputs the result
          * @param input The input samples
@@ -79,17 +94,34 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
          */
         void Reset();
 
+        /**
+         * @brief Checks whether the convolver has a non-empty impulse response
+         *
+         * @return true: The convolver has an impulse response - false: The convolver only outputs silence
+         */
+        [[nodiscard]] AM_INLINE(bool) HasImpulseResponse() const
+        {
+            return _segCount > 0;
+        }
+
     private:
+        // Allocates the input segments and the convolution buffers, after room for the given number of impulse response segments.
+        AmReal32Buffer AllocateBuffers(AmSize irSegCount);
+
         AmSize _blockSize;
         AmSize _segSize;
         AmSize _segCount;
-        AmSize _fftComplexSize;
-        std::vector<SplitComplex*> _segments;
-        std::vector<SplitComplex*> _segmentsIR;
-        AmAlignedReal32Buffer _fftBuffer;
-        FFT _fft;
-        SplitComplex _preMultiplied;
-        SplitComplex _conv;
+        PFFFT_Setup* _fft;
+
+        // Spectra are kept in the internal layout of PFFFT, which is never reordered.
+        AmReal32Buffer _data;
+        AmReal32Buffer _segments;
+        const AmReal32* _segmentsIR;
+        AmReal32Buffer _preMultiplied;
+        AmReal32Buffer _conv;
+        AmReal32Buffer _fftBuffer;
+        AmReal32Buffer _work;
+
         AmAlignedReal32Buffer _overlap;
         AmSize _current;
         AmAlignedReal32Buffer _inputBuffer;
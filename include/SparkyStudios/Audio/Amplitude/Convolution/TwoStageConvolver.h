@@ -20,6 +20,8 @@
 #ifndef SS_AMPLITUDE_AUDIO_CONVOLUTION_TWO_STAGE_CONVOLVER_H
 #define SS_AMPLITUDE_AUDIO_CONVOLUTION_TWO_STAGE_CONVOLVER_H
 
+#include <atomic>
+
 #include <SparkyStudios/Audio/Amplitude/Convolution/Convolver.h>
 
 namespace SparkyStudios::Audio::Amplitude::Convolution
@@ -40,7 +42,12 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
      *
      * Furthermore, this convolver class provides virtual methods which provide the
      * possibility to move the tail convolution into the background (e.g. by using
-     * multithreading, see StartBackgroundProcessing()/WaitForBackgroundProcessing()).
+     * multithreading, see StartBackgroundProcessing()).
+     *
+     * The result of a background convolution is only needed two tail blocks after
+     * the block it was started for, the second tail block of the impulse response
+     * being convolved with the head block size. Processing never waits for the
+     * background convolution: a tail block which isn't ready in time is dropped.
      *
      * As well as the basic Convolver class, the 2-stage convolver is suitable
      * for real-time processing which means that no "unpredictable" operations like
@@ -69,6 +76,18 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
          */
         bool Init(size_t headBlockSize, size_t tailBlockSize, const AmAudioSample* ir, size_t irLen);
 
+        /**
+         * @brief Initializes the convolver with the impulse response of another convolver.
+         *
+         * The spectra of the impulse response are shared instead of computed again, so the
+         * prototype must outlive this convolver.
+         *
+         * @param prototype The convolver to share the impulse response with.
+         *
+         * @return @c true on success, @c false otherwise.
+         */
+        bool Init(const TwoStageConvolver& prototype);
+
         /**
          * @brief Convolves the the given input samples and immediately outputs the result
          *
@@ -80,6 +99,8 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
 
         /**
          * @brief Resets the convolver and discards the set impulse response
+         *
+         * No background processing must be running.
          */
         void Reset();
 
@@ -90,23 +111,33 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
          * The default implementation just calls DoBackgroundProcessing() to perform the "bulk"
          * convolution. However, if you want to perform the majority of work in some background
          * thread (which is recommended), you can overload this method and trigger the execution
-         * of DoBackgroundProcessing() really in some background thread.
+         * of DoBackgroundProcessing() really in some background thread. This method must not
+         * block, and DoBackgroundProcessing() must not run concurrently with itself.
          */
         virtual void StartBackgroundProcessing();
 
         /**
-         * @brief Called by the convolver if it expects the result of its previous call to startBackgroundProcessing()
+         * @brief Actually performs the background processing work
          *
-         * After returning from this method, all background processing has to be completed.
+         * Convolves all the tail blocks queued since the previous call.
          */
-        virtual void WaitForBackgroundProcessing();
+        void DoBackgroundProcessing();
 
         /**
-         * @brief Actually performs the background processing work
+         * @brief Checks whether some tail blocks are queued for background processing.
+         *
+         * @return @c true if DoBackgroundProcessing() has some work to do, @c false otherwise.
          */
-        void DoBackgroundProcessing();
+        [[nodiscard]] bool HasBackgroundProcessing() const;
 
     private:
+        // The number of tail blocks queued for, being processed by, or waiting to be summed from the background processing.
+        static constexpr AmSize kBackgroundBlocks = 3;
+
+        void InitBuffers();
+
+        void QueueBackgroundProcessing();
+
         size_t _headBlockSize;
         size_t _tailBlockSize;
         Convolver _headConvolver;
@@ -114,12 +145,18 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
         AmAlignedReal32Buffer _tailOutput0;
         AmAlignedReal32Buffer _tailPrecalculated0;
         Convolver _tailConvolver;
-        AmAlignedReal32Buffer _tailOutput;
         AmAlignedReal32Buffer _tailPrecalculated;
         AmAlignedReal32Buffer _tailInput;
         size_t _tailInputFill;
         size_t _precalculatedPos;
-        AmAlignedReal32Buffer _backgroundProcessingInput;
+        AmUInt64 _tailBlock;
+
+        AmAlignedReal32Buffer _backgroundInputs[kBackgroundBlocks];
+        AmAlignedReal32Buffer _backgroundOutputs[kBackgroundBlocks];
+        AmUInt64 _backgroundBlocks[kBackgroundBlocks];
+        std::atomic<AmUInt64> _backgroundQueued;
+        std::atomic<AmUInt64> _backgroundProcessed;
+        AmUInt64 _backgroundSummed;
     };
 } // namespace SparkyStudios::Audio::Amplitude::Convolution
 
@@ -17,7 +17,11 @@
 #ifndef SS_AMPLITUDE_AUDIO_CODEC_H
 #define SS_AMPLITUDE_AUDIO_CODEC_H
 
+#include <map>
+#include <vector>
+
 #include <SparkyStudios/Audio/Amplitude/Core/Common.h>
+#include <SparkyStudios/Audio/Amplitude/Core/Thread.h>
 #include <SparkyStudios/Audio/Amplitude/IO/FileSystem.h>
 
 namespace SparkyStudios::Audio::Amplitude
@@ -47,6 +51,7 @@ namespace SparkyStudios::Audio::Amplitude
             explicit Decoder(const Codec* codec)
                 : m_format()
                 , m_codec(codec)
+                , m_cursor(0)
             {}
 
             virtual ~Decoder() = default;
@@ -61,10 +66,29 @@ namespace SparkyStudios::Audio::Amplitude
             /**
              * @brief Closes the file previously opened.
              *
+             * Implementations should keep their internal buffers after closing the file,
+             * so they can be reused by the next call to Open().
+             *
              * @return Whether is operation is successful.
              */
             virtual bool Close() = 0;
 
+            /**
+             * @brief Closes the current file, if any, and opens the given one.
+             *
+             * This is the path used to recycle decoders from the codec pool. The default
+             * implementation calls Close() then Open().
+             *
+             * @param file The file to read.
+             *
+             * @return Whether the operation is successful.
+             */
+            virtual bool Reset(std::shared_ptr<File> file)
+            {
+                Close();
+                return Open(file);
+            }
+
             /**
              * @brief Gets the audio sample format.
              *
@@ -75,6 +99,20 @@ namespace SparkyStudios::Audio::Amplitude
                 return m_format;
             }
 
+            /**
+             * @brief Gets whether the file stores its samples as integer PCM.
+             *
+             * Decoders always output float32 samples. Sounds decoded from integer PCM sources
+             * with up to 16 bits per sample can be stored as 16-bit samples without any loss.
+             * The default implementation returns false.
+             *
+             * @return Whether the file stores its samples as integer PCM.
+             */
+            [[nodiscard]] virtual bool HasIntegerSamples() const
+            {
+                return false;
+            }
+
             /**
              * @breif Loads the entire audio file into the output buffer.
              *
@@ -98,6 +136,23 @@ namespace SparkyStudios::Audio::Amplitude
              */
             virtual AmUInt64 Stream(AmVoidPtr out, AmUInt64 offset, AmUInt64 length) = 0;
 
+            /**
+             * @brief Streams the frames following the last read into the output buffer.
+             *
+             * This is meant for strictly sequential consumers, and never moves the cursor
+             * elsewhere than after the read frames. The default implementation calls Stream()
+             * at the current cursor.
+             *
+             * @param out The buffer to stream the file data into.
+             * @param length The length in frames to read from the file.
+             *
+             * @return The number of frames read.
+             */
+            virtual AmUInt64 StreamNext(AmVoidPtr out, AmUInt64 length)
+            {
+                return Stream(out, m_cursor, length);
+            }
+
             /**
              * @brief Moves the cursor to the given frame.
              * @param offset The offset in frames to move the cursor to.
@@ -106,6 +161,16 @@ namespace SparkyStudios::Audio::Amplitude
              */
             virtual bool Seek(AmUInt64 offset) = 0;
 
+            /**
+             * @brief Gets the frame at which the next read will start.
+             *
+             * @return The current cursor position in frames.
+             */
+            [[nodiscard]] AmUInt64 GetCursor() const
+            {
+                return m_cursor;
+            }
+
         protected:
             /**
              * @brief The audio sample format of the file
@@ -120,6 +185,14 @@ namespace SparkyStudios::Audio::Amplitude
              * @brief The codec instance which built this decoder.
              */
             const Codec* m_codec;
+
+            /**
+             * @brief The frame at which the next read will start.
+             *
+             * Implementations must keep it up to date when reading and seeking, so that
+             * sequential reads can skip seeking.
+             */
+            AmUInt64 m_cursor;
         };
 
         /**
@@ -200,7 +273,7 @@ namespace SparkyStudios::Audio::Amplitude
          */
         explicit Codec(AmString name);
 
-        virtual ~Codec() = default;
+        virtual ~Codec();
 
         /**
          * @brief Creates a new instance of the decoder associated
@@ -217,6 +290,41 @@ namespace SparkyStudios::Audio::Amplitude
          */
         virtual void DestroyDecoder(Decoder* decoder) = 0;
 
+        /**
+         * @brief Gets a decoder from the pool of this codec, or creates a new one
+         * if the pool is empty.
+         *
+         * The returned decoder is closed, and should be opened with Decoder::Reset().
+         *
+         * @return A Decoder instance.
+         */
+        [[nodiscard]] Decoder* AcquireDecoder();
+
+        /**
+         * @brief Closes the given decoder and gives it back to the pool of this codec.
+         *
+         * The decoder is destroyed if the pool is full.
+         *
+         * @param decoder The decoder instance to release.
+         */
+        void ReleaseDecoder(Decoder* decoder);
+
+        /**
+         * @brief Sets the maximum number of decoders kept in the pool of this codec.
+         *
+         * @param size The maximum number of pooled decoders.
+         */
+        void SetDecoderPoolSize(AmSize size);
+
+        /**
+         * @brief Destroys all the decoders kept in the pool of this codec.
+         *
+         * Pooled decoders are destroyed with DestroyDecoder(), which can't be called
+         * from the Codec destructor. The engine calls this method on every registered
+         * codec before it unregisters them.
+         */
+        void Release();
+
         /**
          * @brief Creates a new instance of the encoder associated
          * to this codec.
@@ -283,11 +391,23 @@ namespace SparkyStudios::Audio::Amplitude
          */
         static void LockRegistry();
 
+        /**
+         * @brief Gets the list of registered Codecs.
+         *
+         * @return The registry of Codecs.
+         */
+        static const std::map<AmString, Codec*>& GetRegistry();
+
     protected:
         /**
          * @brief The name of this codec.
          */
         AmString m_name;
+
+    private:
+        std::vector<Decoder*> _decoderPool;
+        AmSize _decoderPoolSize;
+        AmMutexHandle _decoderPoolMutex;
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
@@ -89,4 +89,7 @@
 // Maximum number of tasks in a single pool
 #define AM_MAX_THREAD_POOL_TASKS 1024
 
+// Maximum number of sound processor instances storing a state in each sound instance
+#define AM_MAX_SOUND_PROCESSOR_STATES 32
+
 #endif // SS_AMPLITUDE_AUDIO_CONFIG_H
@@ -1176,6 +1176,13 @@ namespace SparkyStudios::Audio::Amplitude
          */
         [[nodiscard]] AmUInt32 GetSamplesPerStream() const;
 
+        /**
+         * @brief Gets the statistics of the cache keeping the decoded data of non-streamed sounds.
+         *
+         * @return The hits, misses, evictions and memory usage of the sound data cache.
+         */
+        [[nodiscard]] SoundDataCacheStats GetSoundDataCacheStats() const;
+
         /**
          * @brief Checks whether the game is tracking environment amounts
          * himself. This is useful for engines like O3DE.
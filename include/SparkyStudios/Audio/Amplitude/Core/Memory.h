@@ -18,6 +18,8 @@
 #ifndef SS_AMPLITUDE_AUDIO_MEMORY_H
 #define SS_AMPLITUDE_AUDIO_MEMORY_H
 
+#include <mutex>
+
 #include <SparkyStudios/Audio/Amplitude/Core/Common.h>
 
 /**
@@ -474,6 +476,7 @@ namespace SparkyStudios::Audio::Amplitude
         MemoryManagerConfig _config;
 
         std::set<Allocation> _memAllocations = {};
+        mutable std::mutex _memAllocationsMutex;
 
 #if !defined(AM_NO_MEMORY_STATS)
         std::map<MemoryPoolKind, MemoryPoolStats> _memPoolsStats = {};
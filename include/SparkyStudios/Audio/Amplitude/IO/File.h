@@ -290,11 +290,26 @@ namespace SparkyStudios::Audio::Amplitude
          */
         AmResult OpenFileToMem(File* file);
 
+        /**
+         * @brief Opens the memory buffer of another memory file, without copying it.
+         *
+         * Both files read the same data, each one from its own position. The other file must
+         * outlive this one.
+         *
+         * @param source The memory file to share the buffer of.
+         *
+         * @return The result of the operation.
+         */
+        AmResult OpenShared(const MemoryFile& source);
+
     private:
         AmUInt8Buffer m_dataPtr;
         AmSize m_dataSize;
         AmSize m_offset;
         bool m_dataOwned;
+
+        // The path of the file the data was read from, if any.
+        AmOsString m_filePath;
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
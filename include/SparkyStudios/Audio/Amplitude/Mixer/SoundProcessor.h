@@ -25,8 +25,8 @@ namespace SparkyStudios::Audio::Amplitude
     class AM_API_PUBLIC SoundProcessorInstance
     {
     public:
-        SoundProcessorInstance() = default;
-        virtual ~SoundProcessorInstance() = default;
+        SoundProcessorInstance();
+        virtual ~SoundProcessorInstance();
 
         virtual void Process(
             AmAudioSampleBuffer out,
@@ -39,6 +39,18 @@ namespace SparkyStudios::Audio::Amplitude
 
         virtual AmSize GetOutputBufferSize(AmUInt64 frames, AmSize bufferSize, AmUInt16 channels, AmUInt32 sampleRate);
 
+        /**
+         * @brief Prepares the given sound instance to be processed.
+         *
+         * This is called from the engine thread when the sound instance starts playing. Processors
+         * needing a state for each sound should allocate it here, and store it in the sound instance
+         * with SoundInstance::SetProcessorState() using their state slot. The state is then
+         * retrieved while processing without any lookup or allocation.
+         *
+         * @param sound The sound instance to prepare.
+         */
+        virtual void Prepare(SoundInstance* sound);
+
         /**
          * @brief Cleans up all the memory allocated when the given
          * sound instance was processed.
@@ -49,6 +61,17 @@ namespace SparkyStudios::Audio::Amplitude
          * @param sound The sound instance to clean up.
          */
         virtual void Cleanup(SoundInstance* sound);
+
+        /**
+         * @brief Gets the slot in which this processor instance stores its state in sound instances.
+         *
+         * @return The state slot of this processor instance, or AM_MAX_SOUND_PROCESSOR_STATES if
+         * all the slots are already used.
+         */
+        [[nodiscard]] AmUInt32 GetStateSlot() const;
+
+    protected:
+        AmUInt32 m_stateSlot;
     };
 
     class AM_API_PUBLIC SoundProcessor
@@ -159,6 +182,10 @@ namespace SparkyStudios::Audio::Amplitude
             AmUInt32 sampleRate,
             SoundInstance* sound) override;
 
+        void Prepare(SoundInstance* sound) override;
+
+        void Cleanup(SoundInstance* sound) override;
+
     private:
         SoundProcessorInstance* _wetProcessor;
         SoundProcessorInstance* _dryProcessor;
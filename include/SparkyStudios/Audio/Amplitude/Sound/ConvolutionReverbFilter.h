@@ -0,0 +1,149 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef SS_AMPLITUDE_AUDIO_CONVOLUTION_REVERB_FILTER_H
+#define SS_AMPLITUDE_AUDIO_CONVOLUTION_REVERB_FILTER_H
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
+#include <SparkyStudios/Audio/Amplitude/Core/Thread.h>
+
+#include <SparkyStudios/Audio/Amplitude/Convolution/TwoStageConvolver.h>
+
+#include <SparkyStudios/Audio/Amplitude/Sound/Filter.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    class ConvolutionReverbFilterInstance;
+
+    /**
+     * @brief A reverb filter convolving sounds with an impulse response.
+     *
+     * Each convolution reverb is registered with its own name and impulse response file, and
+     * is then used by effects like any other filter. For example:
+     *
+     * @code{.cpp}
+     * // Before the engine initialization
+     * static ConvolutionReverbFilter gCathedral("Cathedral", AM_OS_STRING("irs/cathedral.wav"));
+     * @endcode
+     *
+     * The impulse response is read through the engine's FileSystem and decoded with the
+     * registered codecs, either when calling Load(), or on the sound data loader threads
+     * when the first instance of the filter is created. Instances only output the dry signal
+     * until it's loaded. Its sample rate should match the sample rate of the processed sounds.
+     * The impulse response is transformed once, and shared by all the instances.
+     *
+     * The beginning of the impulse response is convolved on the audio thread with short
+     * blocks, while its tail is convolved on background threads with long blocks. This keeps
+     * the cost of each audio callback low, even for impulse responses of several seconds.
+     * The audio thread never waits for the background threads: the parts of the tail they
+     * are too late for are dropped.
+     */
+    class AM_API_PUBLIC ConvolutionReverbFilter final : public Filter
+    {
+        friend class ConvolutionReverbFilterInstance;
+        friend class LoadImpulseResponseTask;
+
+    public:
+        enum ATTRIBUTE
+        {
+            ATTRIBUTE_WET = 0,
+            ATTRIBUTE_DRY,
+            ATTRIBUTE_LAST
+        };
+
+        /**
+         * @brief Creates and registers a new convolution reverb.
+         *
+         * @param name The name of the filter, used by effects to reference it.
+         * @param path The path to the impulse response file, relative to the engine's FileSystem.
+         */
+        ConvolutionReverbFilter(std::string name, AmOsString path);
+        ~ConvolutionReverbFilter() override;
+
+        /**
+         * @brief Loads the impulse response, if not already loaded.
+         *
+         * This must be called after the engine initialization. Otherwise, the impulse response
+         * is loaded in the background when creating the first instance of the filter.
+         *
+         * @return The result of the operation.
+         */
+        AmResult Load();
+
+        /**
+         * @brief Releases the impulse response and the background threads.
+         *
+         * The instances of the filter use both of them, so nothing is released while some of
+         * them are still alive. This must be called before deinitializing the memory manager,
+         * if the filter outlives it.
+         *
+         * @return The result of the operation.
+         */
+        AmResult Unload();
+
+        /**
+         * @brief Gets the path to the impulse response file.
+         *
+         * @return The path to the impulse response file.
+         */
+        [[nodiscard]] const AmOsString& GetPath() const;
+
+        [[nodiscard]] AmUInt32 GetParamCount() const override;
+
+        [[nodiscard]] AmString GetParamName(AmUInt32 index) const override;
+
+        [[nodiscard]] AmUInt32 GetParamType(AmUInt32 index) const override;
+
+        [[nodiscard]] AmReal32 GetParamMax(AmUInt32 index) const override;
+
+        [[nodiscard]] AmReal32 GetParamMin(AmUInt32 index) const override;
+
+        FilterInstance* CreateInstance() override;
+
+        void DestroyInstance(FilterInstance* instance) override;
+
+    private:
+        AmResult LoadImpulseResponse();
+
+        void DestroyPrototypes();
+
+        AmOsString _path;
+
+        // The impulse response of each channel, transformed once and shared by the convolvers of all the instances.
+        Convolution::TwoStageConvolver* _prototypes[AM_MAX_CHANNELS];
+        AmUInt16 _channels;
+
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        bool _loaded;
+        bool _loading;
+
+        // The number of live instances, which use the impulse response and the background threads.
+        AmUInt32 _instancesCount;
+
+        // The instances created while the impulse response is loading.
+        std::vector<ConvolutionReverbFilterInstance*> _pendingInstances;
+
+        // Runs the tail convolutions of all the instances.
+        AmUniquePtr<MemoryPoolKind::Filtering, Thread::Pool> _workers;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // SS_AMPLITUDE_AUDIO_CONVOLUTION_REVERB_FILTER_H
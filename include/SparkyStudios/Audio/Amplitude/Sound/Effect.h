@@ -20,6 +20,7 @@
 #include <SparkyStudios/Audio/Amplitude/Core/Common.h>
 
 #include <SparkyStudios/Audio/Amplitude/Core/Asset.h>
+#include <SparkyStudios/Audio/Amplitude/Core/Thread.h>
 
 #include <SparkyStudios/Audio/Amplitude/Sound/Filter.h>
 #include <SparkyStudios/Audio/Amplitude/Sound/Rtpc.h>
@@ -79,7 +80,9 @@ namespace SparkyStudios::Audio::Amplitude
     private:
         friend class EffectInstance;
 
-        std::vector<EffectInstance*> _instances;
+        // The live instances of this effect, updated by Update(). Instances are destroyed from the mixer thread.
+        mutable std::vector<EffectInstance*> _instances;
+        AmMutexHandle _instancesMutex;
 
         std::vector<RtpcValue> _parameters;
 
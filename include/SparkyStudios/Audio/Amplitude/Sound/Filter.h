@@ -174,22 +174,123 @@ namespace SparkyStudios::Audio::Amplitude
 
         virtual void AdvanceFrame(AmTime delta_time);
 
+        /**
+         * @brief Processes a block of interleaved audio frames in place.
+         *
+         * The default implementation calls ProcessChannel() once per channel. Filters which
+         * can process all the channels at once, or which share state between channels, should
+         * override this method instead.
+         *
+         * Parameters changed with SetFilterParameter() are only taken into account between
+         * blocks: the default implementation applies them with UpdateParameters() before
+         * processing the channels. Filters overriding this method must call UpdateParameters()
+         * first, and only once per block. Implementations should read the parameters once per
+         * block, not once per sample, and use GetParameterRamp() to smooth the changes of the
+         * parameters which would otherwise produce clicks. The built-in filters ramp all their
+         * continuous parameters, the biquad based ones by interpolating their coefficients.
+         * Parameters which resize a delay line or select a mode are applied at the start of the
+         * block: the delay of the Delay and Flanger filters, the delay start of the Delay filter,
+         * the type of the BiquadResonant filter, the waveform of the Robotize filter and the mode
+         * of the Freeverb filter.
+         *
+         * @param buffer The interleaved audio buffer to process.
+         * @param frames The number of frames to process.
+         * @param bufferSize The total size of the buffer, in samples.
+         * @param channels The number of channels in the buffer.
+         * @param sampleRate The sample rate of the audio data.
+         */
         virtual void Process(AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate);
 
+        /**
+         * @brief Processes one channel of a block of interleaved audio frames in place.
+         *
+         * The samples of the channel are located at <code>buffer[channel + i * channels]</code>.
+         * The default implementation calls ProcessSample() for each of them. Built-in filters
+         * override this method with a dedicated loop, to avoid a virtual call per sample.
+         *
+         * @param buffer The interleaved audio buffer to process.
+         * @param channel The index of the channel to process.
+         * @param frames The number of frames to process.
+         * @param channels The number of channels in the buffer.
+         * @param sampleRate The sample rate of the audio data.
+         */
         virtual void ProcessChannel(AmAudioSampleBuffer buffer, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate);
 
+        /**
+         * @brief Processes a single audio sample.
+         *
+         * This is the simplest way to implement a filter, but also the slowest one. The default
+         * implementation returns the sample unchanged.
+         *
+         * @param sample The audio sample to process.
+         * @param channel The channel of the audio sample.
+         * @param sampleRate The sample rate of the audio data.
+         *
+         * @return The processed audio sample.
+         */
         virtual AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate);
 
+        /**
+         * @brief Gets the value of a parameter, as used by the last processed block.
+         *
+         * @param attributeId The index of the parameter.
+         *
+         * @return The value of the parameter.
+         */
         virtual AmReal32 GetFilterParameter(AmUInt32 attributeId);
 
+        /**
+         * @brief Publishes a new value for a parameter.
+         *
+         * This is safe to call from another thread than the one processing the filter, without
+         * locks. Setting a parameter to the last value it was set to costs a single comparison.
+         * The new value is applied at the start of the next processed block.
+         *
+         * @param attributeId The index of the parameter.
+         * @param value The new value of the parameter.
+         */
         virtual void SetFilterParameter(AmUInt32 attributeId, AmReal32 value);
 
     protected:
+        /**
+         * @brief Applies the parameters published with SetFilterParameter().
+         *
+         * This is called by Process() at the start of each block, on the thread processing the filter.
+         * The changed parameters are flagged in <code>m_numParamsChanged</code>, and ramp from their
+         * previous value across the block.
+         */
+        void UpdateParameters();
+
+        /**
+         * @brief Gets the ramp of a parameter across the block being processed.
+         *
+         * The ramp starts at the value used by the previous block, and reaches the current value
+         * of the parameter at the end of the block. Parameters which did not change have a null step.
+         *
+         * @param attributeId The index of the parameter.
+         * @param frames The number of frames in the block.
+         * @param step Receives the increment of the parameter per frame.
+         *
+         * @return The value of the parameter at the first frame of the block.
+         */
+        AmReal32 GetParameterRamp(AmUInt32 attributeId, AmUInt64 frames, AmReal32& step) const;
+
         Filter* m_parent;
 
         AmUInt32 m_numParams;
         AmUInt32 m_numParamsChanged;
         AmReal32Buffer m_parameters;
+
+    private:
+        void FreeParameters();
+
+        // Values published by SetFilterParameter(), applied by UpdateParameters().
+        std::atomic<AmReal32>* _pendingParameters;
+        std::atomic<AmUInt32> _pendingParamsChanged;
+
+        // Values of the parameters at the start of the current block, and the parameters ramping in it.
+        AmReal32Buffer _rampParameters;
+        AmUInt32 _rampingParams;
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
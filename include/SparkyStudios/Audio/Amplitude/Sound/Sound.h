@@ -19,6 +19,7 @@
 
 #include <SparkyStudios/Audio/Amplitude/Core/Codec.h>
 #include <SparkyStudios/Audio/Amplitude/Core/Common.h>
+#include <SparkyStudios/Audio/Amplitude/Core/Thread.h>
 
 #include <SparkyStudios/Audio/Amplitude/Sound/SoundObject.h>
 
@@ -56,6 +57,63 @@ namespace SparkyStudios::Audio::Amplitude
         Standalone,
     };
 
+    /**
+     * @brief Describes the loading state of the decoded data of a non-streamed Sound.
+     */
+    enum class SoundDataState : AmUInt8
+    {
+        /**
+         * @brief The sound data is not in memory.
+         */
+        Unloaded,
+
+        /**
+         * @brief The sound data is being decoded in the background.
+         */
+        Loading,
+
+        /**
+         * @brief The sound data is decoded and can be mixed.
+         */
+        Loaded,
+
+        /**
+         * @brief The sound data could not be decoded.
+         */
+        Failed,
+    };
+
+    /**
+     * @brief Statistics collected by the cache of decoded sound data.
+     */
+    struct SoundDataCacheStats
+    {
+        /**
+         * @brief The number of times decoded data was found in the cache.
+         */
+        AmUInt64 hits = 0;
+
+        /**
+         * @brief The number of times decoded data was not found in the cache.
+         */
+        AmUInt64 misses = 0;
+
+        /**
+         * @brief The number of entries evicted to respect the memory budget.
+         */
+        AmUInt64 evictions = 0;
+
+        /**
+         * @brief The amount of memory in bytes currently held by the cache.
+         */
+        AmSize residentSize = 0;
+
+        /**
+         * @brief The amount of memory in bytes held by pinned entries.
+         */
+        AmSize pinnedSize = 0;
+    };
+
     /**
      * @brief Stores all the information required to play a sound instance.
      */
@@ -124,7 +182,9 @@ namespace SparkyStudios::Audio::Amplitude
          * @brief Returns the SoundChunk associated with this Sound
          * and increment its reference counter.
          *
-         * If the reference equals 0, the SoundChunk is created.
+         * If the reference equals 0, the SoundChunk is created and the audio file is
+         * decoded in the background. Use GetSoundDataState() to know when the returned
+         * SoundChunk is ready to be mixed.
          *
          * This methods is used by the SoundInstance to get the SoundChunk
          * only when the audio file is not streamed.
@@ -145,6 +205,15 @@ namespace SparkyStudios::Audio::Amplitude
          */
         void ReleaseSoundData();
 
+        /**
+         * @brief Gets the loading state of the SoundChunk of this Sound.
+         *
+         * Streamed sounds are always considered as loaded.
+         *
+         * @return The loading state of the sound data.
+         */
+        [[nodiscard]] SoundDataState GetSoundDataState() const;
+
         /**
          * @brief Checks streaming is enabled for this Sound.
          *
@@ -159,8 +228,36 @@ namespace SparkyStudios::Audio::Amplitude
          */
         [[nodiscard]] bool IsLoop() const;
 
+        /**
+         * @brief Checks if the audio file of this Sound has been opened.
+         *
+         * Sounds from sound banks using the LoadOnFirstUse load policy are loaded
+         * the first time they are played.
+         *
+         * @return true if the audio file has been opened, false otherwise.
+         */
+        [[nodiscard]] bool IsLoaded() const;
+
+        /**
+         * @brief Opens the audio file of this Sound.
+         *
+         * Calling this method on an already loaded Sound does nothing.
+         *
+         * @param loader The file system to open the audio file from.
+         */
         void Load(const FileSystem* loader) override;
 
+        /**
+         * @brief Opens the audio file of this Sound in the background.
+         *
+         * The file is opened, and the head of streamed sounds is prefetched, by the sound data
+         * loader threads. Use IsLoaded() to know when the Sound is ready to be played. Calling
+         * this method on a Sound which is already loaded or being loaded does nothing.
+         *
+         * @param loader The file system to open the audio file from.
+         */
+        void LoadAsync(const FileSystem* loader);
+
         bool LoadDefinition(const SoundDefinition* definition, EngineInternalState* state) override;
         [[nodiscard]] const SoundDefinition* GetDefinition() const override;
         void AcquireReferences(EngineInternalState* state) override;
@@ -169,11 +266,17 @@ namespace SparkyStudios::Audio::Amplitude
     private:
         friend class Collection;
         friend class SoundInstance;
+        friend class DecodeSoundDataTask;
+        friend class OpenSoundSourceTask;
+
+        void OpenSource(const FileSystem* loader);
 
         Codec* _codec;
         Codec::Decoder* _decoder;
 
         bool _stream;
+        bool _keepCompressed;
+        std::shared_ptr<MemoryFile> _compressedData;
         bool _loop;
         AmUInt32 _loopCount;
 
@@ -182,6 +285,18 @@ namespace SparkyStudios::Audio::Amplitude
         SoundChunk* _soundData;
         SoundFormat _format;
         RefCounter _soundDataRefCounter;
+        AmMutexHandle _soundDataMutex;
+        std::atomic<SoundDataState> _soundDataState;
+        bool _cachePinned;
+
+        AmUInt32 _streamPrefetchDuration;
+        SoundChunk* _streamPrefetchData;
+        AmUInt64 _streamPrefetchFrames;
+
+        std::atomic<bool> _loaded;
+        bool _loadPending;
+        std::mutex _loadMutex;
+        std::condition_variable _loadCondition;
     };
 
     class AM_API_PUBLIC SoundInstance
@@ -202,9 +317,19 @@ namespace SparkyStudios::Audio::Amplitude
 
         /**
          * @brief Loads the audio sample data into this SoundInstance.
+         *
+         * When the parent Sound is not loaded yet, its audio file is opened on the calling thread.
+         * Use LoadAsync() first to avoid blocking.
          */
         void Load();
 
+        /**
+         * @brief Opens the audio file of the parent Sound in the background if it's not loaded yet.
+         *
+         * @return true if the parent Sound is loaded and Load() won't block, false if it's still being loaded.
+         */
+        bool LoadAsync();
+
         /**
          * @brief Get the settings used to create this SoundInstance.
          *
@@ -334,12 +459,37 @@ namespace SparkyStudios::Audio::Amplitude
          */
         [[nodiscard]] AmObjectID GetId() const;
 
+        /**
+         * @brief Gets the state stored by a sound processor for this SoundInstance.
+         *
+         * @param slot The state slot of the sound processor instance.
+         *
+         * @return The stored state, or nullptr if no state is stored in the given slot.
+         */
+        [[nodiscard]] AmVoidPtr GetProcessorState(AmUInt32 slot) const;
+
+        /**
+         * @brief Stores the state of a sound processor for this SoundInstance.
+         *
+         * Sound processors should store their state when preparing the sound instance,
+         * and release it when cleaning it up.
+         *
+         * @param slot The state slot of the sound processor instance.
+         * @param state The state to store.
+         */
+        void SetProcessorState(AmUInt32 slot, AmVoidPtr state);
+
     private:
+        bool OpenCompressedData();
+
         AmVoidPtr _userData;
 
         RealChannel* _channel;
         Sound* _parent;
         const Collection* _collection;
+
+        // Sounds kept compressed in memory are decoded with one decoder per instance.
+        Codec::Decoder* _decoder;
         const Effect* _effect;
         EffectInstance* _effectInstance;
 
@@ -351,6 +501,10 @@ namespace SparkyStudios::Audio::Amplitude
         AmReal32 _occlusion;
 
         AmObjectID _id;
+
+        AmUInt64 _loadTime;
+
+        AmVoidPtr _processorStates[AM_MAX_SOUND_PROCESSOR_STATES];
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
@@ -18,6 +18,7 @@
 #define SPARK_AUDIO_SOUND_BANK_H
 
 #include <queue>
+#include <vector>
 
 #include <SparkyStudios/Audio/Amplitude/Core/RefCounter.h>
 
@@ -102,6 +103,12 @@ namespace SparkyStudios::Audio::Amplitude
          *
          * This method should usually not be called directly. It is called automatically by the Engine with
          * the @code Engine::StartLoadSoundFiles() @endcode method.
+         *
+         * When the sound bank uses the PreloadOnLoad decode policy, the data of the non-streamed sounds
+         * is also decoded here and kept in memory until the sound bank is unloaded.
+         *
+         * When the sound bank uses the LoadOnFirstUse load policy, the sound files are not opened here,
+         * each sound opens its file the first time it is played.
          */
         void LoadSoundFiles(const Engine* engine);
 
@@ -115,6 +122,7 @@ namespace SparkyStudios::Audio::Amplitude
         AmBankID _id;
 
         std::queue<AmSoundID> _pendingSoundsToLoad;
+        std::vector<AmSoundID> _preloadedSounds;
     };
 
 } // namespace SparkyStudios::Audio::Amplitude
@@ -14,39 +14,99 @@
 
 #include <Codec.h>
 
-void FlacCodec::FlacDecoderInternal::set_current_output_buffer(AmAudioSampleBuffer output, AmUInt64 size)
+/**
+ * @brief Converts planar FLAC samples into interleaved float samples.
+ *
+ * The loops are kept branch free with non-aliasing pointers, so they are vectorized by the compiler
+ * for the mono and stereo cases.
+ */
+static void ConvertPlanarToInterleaved(
+    AmAudioSampleBuffer AM_RESTRICT out, const FLAC__int32* const in[], AmUInt32 frames, AmUInt32 channels, AmReal32 scale)
 {
-    _current_output_buffer = output;
-    _current_output_buffer_size = size;
+    if (channels == 1)
+    {
+        const FLAC__int32* AM_RESTRICT mono = in[0];
+
+        for (AmUInt32 i = 0; i < frames; i++)
+            out[i] = static_cast<AmReal32>(mono[i]) * scale;
+    }
+    else if (channels == 2)
+    {
+        const FLAC__int32* AM_RESTRICT left = in[0];
+        const FLAC__int32* AM_RESTRICT right = in[1];
+
+        for (AmUInt32 i = 0; i < frames; i++)
+        {
+            out[i * 2 + 0] = static_cast<AmReal32>(left[i]) * scale;
+            out[i * 2 + 1] = static_cast<AmReal32>(right[i]) * scale;
+        }
+    }
+    else
+    {
+        for (AmUInt32 j = 0; j < channels; j++)
+        {
+            const FLAC__int32* AM_RESTRICT channel = in[j];
+
+            for (AmUInt32 i = 0; i < frames; i++)
+                out[i * channels + j] = static_cast<AmReal32>(channel[i]) * scale;
+        }
+    }
 }
 
-::FLAC__StreamDecoderWriteStatus FlacCodec::FlacDecoderInternal::write_callback(
-    const ::FLAC__Frame* frame, const FLAC__int32* const buffer[])
+FlacCodec::FlacDecoderInternal::~FlacDecoderInternal()
 {
-    if (_current_output_buffer == nullptr)
-        return ::FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
+    if (_frame_buffer != nullptr)
+        ampoolfree(MemoryPoolKind::Codec, _frame_buffer);
 
-    AmUInt64 sample = _read_frame_count % _current_output_buffer_size;
+    _frame_buffer = nullptr;
+    _frame_buffer_size = 0;
+}
 
-    _need_more_frames = true;
+AmUInt64 FlacCodec::FlacDecoderInternal::read_pending_frames(AmAudioSampleBuffer output, AmUInt64 frames)
+{
+    const AmUInt64 count = AM_MIN(frames, pending_frame_count());
 
-    for (AmUInt32 i = 0; i < frame->header.blocksize; i++)
+    if (count > 0)
     {
-        for (AmUInt32 j = 0; j < frame->header.channels; j++)
-        {
-            _current_output_buffer[(sample * frame->header.channels) + j] = AmInt16ToReal32(buffer[j][i]);
-        }
+        std::memcpy(output, _frame_buffer + _frame_offset * _channels, count * _channels * sizeof(AmAudioSample));
+        _frame_offset += count;
+    }
 
-        sample++;
+    return count;
+}
 
-        if (sample >= _current_output_buffer_size)
-        {
-            _need_more_frames = false;
-            break;
-        }
+void FlacCodec::FlacDecoderInternal::discard_pending_frames()
+{
+    _frame_count = 0;
+    _frame_offset = 0;
+}
+
+::FLAC__StreamDecoderWriteStatus FlacCodec::FlacDecoderInternal::write_callback(
+    const ::FLAC__Frame* frame, const FLAC__int32* const buffer[])
+{
+    const AmUInt32 channels = frame->header.channels;
+    const AmUInt32 frames = frame->header.blocksize;
+    const AmSize samples = static_cast<AmSize>(frames) * channels;
+
+    // The whole frame is kept, the part not requested by the current Stream() call is served by the next one.
+    if (samples > _frame_buffer_size)
+    {
+        if (_frame_buffer != nullptr)
+            ampoolfree(MemoryPoolKind::Codec, _frame_buffer);
+
+        _frame_buffer = static_cast<AmAudioSampleBuffer>(ampoolmalloc(MemoryPoolKind::Codec, samples * sizeof(AmAudioSample)));
+        _frame_buffer_size = _frame_buffer != nullptr ? samples : 0;
+
+        if (_frame_buffer == nullptr)
+            return ::FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
     }
 
-    _read_frame_count = sample;
+    const AmReal32 scale = 1.0f / static_cast<AmReal32>(1ULL << (frame->header.bits_per_sample - 1));
+    ConvertPlanarToInterleaved(_frame_buffer, buffer, frames, channels, scale);
+
+    _frame_count = frames;
+    _frame_offset = 0;
+    _channels = channels;
 
     return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
 }
@@ -140,6 +200,9 @@ bool FlacCodec::FlacDecoder::Open(std::shared_ptr<File> file)
         return false;
     }
 
+    _flac.discard_pending_frames();
+
+    m_cursor = 0;
     _initialized = true;
 
     return true;
@@ -150,10 +213,13 @@ bool FlacCodec::FlacDecoder::Close()
     if (_initialized)
     {
         _flac.finish();
+        _flac.discard_pending_frames();
         _file.reset();
 
         m_format = SoundFormat();
         _initialized = false;
+
+        m_cursor = 0;
     }
 
     // true because it is already closed
@@ -161,39 +227,61 @@ bool FlacCodec::FlacDecoder::Close()
 }
 
 AmUInt64 FlacCodec::FlacDecoder::Load(AmVoidPtr out)
+{
+    return Stream(out, 0, m_format.GetFramesCount());
+}
+
+AmUInt64 FlacCodec::FlacDecoder::Stream(AmVoidPtr out, AmUInt64 offset, AmUInt64 length)
 {
     if (!_initialized)
         return 0;
 
-    _flac.set_current_output_buffer(static_cast<AmAudioSampleBuffer>(out), m_format.GetFramesCount());
-
-    if (!Seek(0))
+    // Sequential reads continue from the current position without seeking.
+    if (offset != m_cursor && !Seek(offset))
         return 0;
 
-    if (_flac.process_until_end_of_stream())
-        return _flac.read_frame_count();
+    const AmUInt16 channels = m_format.GetNumChannels();
+    auto* output = static_cast<AmAudioSampleBuffer>(out);
 
-    return 0;
-}
+    AmUInt64 read = 0;
 
-AmUInt64 FlacCodec::FlacDecoder::Stream(AmVoidPtr out, AmUInt64 offset, AmUInt64 length)
-{
-    if (!_initialized)
-        return 0;
+    while (read < length)
+    {
+        if (_flac.pending_frame_count() == 0)
+        {
+            if (_flac.get_state() == FLAC__STREAM_DECODER_END_OF_STREAM || !_flac.process_single())
+                break;
 
-    _flac.set_current_output_buffer(static_cast<AmAudioSampleBuffer>(out), length);
+            continue;
+        }
 
-    bool seeked = Seek(offset);
+        read += _flac.read_pending_frames(output + read * channels, length - read);
+    }
 
-    while (_flac.need_more_frames() && _flac.get_state() != FLAC__STREAM_DECODER_END_OF_STREAM)
-        _flac.process_single();
+    m_cursor += read;
 
-    return _flac.read_frame_count();
+    return read;
 }
 
 bool FlacCodec::FlacDecoder::Seek(AmUInt64 offset)
 {
-    return _flac.seek_absolute(offset);
+    _flac.discard_pending_frames();
+
+    if (_flac.get_state() == FLAC__STREAM_DECODER_SEEK_ERROR)
+        _flac.flush();
+
+    // On success, the frame containing the target sample is decoded starting at that sample.
+    if (!_flac.seek_absolute(offset))
+        return false;
+
+    m_cursor = offset;
+    return true;
+}
+
+bool FlacCodec::FlacDecoder::HasIntegerSamples() const
+{
+    // FLAC only stores integer samples.
+    return _initialized;
 }
 
 bool FlacCodec::FlacEncoder::Open(std::shared_ptr<File> file)
@@ -33,25 +33,36 @@ public:
         explicit FlacDecoderInternal(FlacDecoder* decoder)
             : FLAC::Decoder::Stream()
             , _decoder(decoder)
-            , _need_more_frames(false)
-            , _current_output_buffer(nullptr)
-            , _read_frame_count(0)
-            , _current_output_buffer_size(0)
+            , _frame_buffer(nullptr)
+            , _frame_buffer_size(0)
+            , _frame_count(0)
+            , _frame_offset(0)
+            , _channels(0)
         {}
 
+        ~FlacDecoderInternal() override;
+
         FlacDecoderInternal(const FlacDecoderInternal&) = delete;
         FlacDecoderInternal& operator=(const FlacDecoderInternal&) = delete;
 
-        void set_current_output_buffer(AmAudioSampleBuffer output, AmUInt64 size);
-
-        [[nodiscard]] bool need_more_frames() const
-        {
-            return _need_more_frames;
-        }
-
-        [[nodiscard]] AmUInt64 read_frame_count() const
+        /**
+         * @brief Copies the decoded frames not yet consumed from the last FLAC frame into the output buffer.
+         *
+         * @param output The interleaved output buffer.
+         * @param frames The maximum number of frames to copy.
+         *
+         * @return The number of copied frames.
+         */
+        AmUInt64 read_pending_frames(AmAudioSampleBuffer output, AmUInt64 frames);
+
+        /**
+         * @brief Drops the decoded frames not yet consumed, e.g. before a seek.
+         */
+        void discard_pending_frames();
+
+        [[nodiscard]] AmUInt64 pending_frame_count() const
         {
-            return _read_frame_count;
+            return _frame_count - _frame_offset;
         }
 
     protected:
@@ -67,11 +78,13 @@ public:
     private:
         FlacDecoder* _decoder;
 
-        bool _need_more_frames;
-        AmUInt64 _read_frame_count;
+        // The last decoded FLAC frame, converted to interleaved float samples.
+        AmAudioSampleBuffer _frame_buffer;
+        AmSize _frame_buffer_size;
 
-        AmAudioSampleBuffer _current_output_buffer;
-        AmUInt64 _current_output_buffer_size;
+        AmUInt64 _frame_count;
+        AmUInt64 _frame_offset;
+        AmUInt32 _channels;
     };
 
     class FlacDecoder final : public Codec::Decoder
@@ -93,6 +106,8 @@ public:
 
         bool Seek(AmUInt64 offset) override;
 
+        [[nodiscard]] bool HasIntegerSamples() const override;
+
     private:
         friend class FlacDecoderInternal;
 
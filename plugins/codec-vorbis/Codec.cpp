@@ -70,6 +70,7 @@ bool VorbisCodec::VorbisDecoder::Open(std::shared_ptr<File> file)
         AM_SAMPLE_FORMAT_FLOAT
     );
 
+    m_cursor = 0;
     _initialized = true;
 
     return true;
@@ -85,6 +86,8 @@ bool VorbisCodec::VorbisDecoder::Close()
         _initialized = false;
         ov_clear(&_vorbis);
 
+        m_cursor = 0;
+
         return true;
     }
 
@@ -102,7 +105,8 @@ AmUInt64 VorbisCodec::VorbisDecoder::Stream(AmVoidPtr out, AmUInt64 offset, AmUI
     if (!_initialized)
         return 0;
 
-    if (!Seek(offset))
+    // Sequential reads continue from the current position without seeking.
+    if (offset != m_cursor && !Seek(offset))
         return 0;
 
     const AmUInt16 channels = m_format.GetNumChannels();
@@ -126,6 +130,7 @@ AmUInt64 VorbisCodec::VorbisDecoder::Stream(AmVoidPtr out, AmUInt64 offset, AmUI
 
             size -= ret;
             read += ret;
+            m_cursor += ret;
         }
         else
         {
@@ -148,7 +153,11 @@ AmUInt64 VorbisCodec::VorbisDecoder::Stream(AmVoidPtr out, AmUInt64 offset, AmUI
 
 bool VorbisCodec::VorbisDecoder::Seek(AmUInt64 offset)
 {
-    return ov_pcm_seek(&_vorbis, offset) >= 0;
+    if (ov_pcm_seek(&_vorbis, offset) < 0)
+        return false;
+
+    m_cursor = offset;
+    return true;
 }
 
 bool VorbisCodec::VorbisEncoder::Open(std::shared_ptr<File> file)
@@ -19,21 +19,26 @@
 
 #include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
 
+#include <Utils/Audio/FFT/PFFFTSetupCache.h>
 #include <Utils/Utils.h>
 
 namespace SparkyStudios::Audio::Amplitude::Convolution
 {
+    // PFFFT needs its buffers aligned for its widest SIMD registers.
+    constexpr AmSize kPFFFTAlignment = 64;
+
     Convolver::Convolver()
         : _blockSize(0)
         , _segSize(0)
         , _segCount(0)
-        , _fftComplexSize(0)
-        , _segments()
-        , _segmentsIR()
-        , _fftBuffer()
-        , _fft()
-        , _preMultiplied()
-        , _conv()
+        , _fft(nullptr)
+        , _data(nullptr)
+        , _segments(nullptr)
+        , _segmentsIR(nullptr)
+        , _preMultiplied(nullptr)
+        , _conv(nullptr)
+        , _fftBuffer(nullptr)
+        , _work(nullptr)
         , _overlap()
         , _current(0)
         , _inputBuffer()
@@ -47,22 +52,23 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
 
     void Convolver::Reset()
     {
-        for (AmSize i = 0; i < _segCount; ++i)
-        {
-            ampooldelete(MemoryPoolKind::Filtering, SplitComplex, _segments[i]);
-            ampooldelete(MemoryPoolKind::Filtering, SplitComplex, _segmentsIR[i]);
-        }
+        if (_fft != nullptr)
+            PFFFTSetupCache::Release(_segSize);
+
+        if (_data != nullptr)
+            ampoolfree(MemoryPoolKind::Filtering, _data);
 
         _blockSize = 0;
         _segSize = 0;
         _segCount = 0;
-        _fftComplexSize = 0;
-        _segments.clear();
-        _segmentsIR.clear();
-        _fftBuffer.Release();
-        _fft.Initialize(0);
-        _preMultiplied.Release();
-        _conv.Release();
+        _fft = nullptr;
+        _data = nullptr;
+        _segments = nullptr;
+        _segmentsIR = nullptr;
+        _preMultiplied = nullptr;
+        _conv = nullptr;
+        _fftBuffer = nullptr;
+        _work = nullptr;
         _overlap.Release();
         _current = 0;
         _inputBuffer.Release();
@@ -83,43 +89,90 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
         if (irLen == 0)
             return true;
 
-        _blockSize = NextPowerOf2(blockSize);
+        // PFFFT has a minimum transform size. A larger block adds no latency, only some work for short inputs.
+        const AmSize minBlockSize = static_cast<AmSize>(pffft_min_fft_size(PFFFT_REAL)) / 2;
+
+        _blockSize = std::max(NextPowerOf2(blockSize), minBlockSize);
         _segSize = 2 * _blockSize;
         _segCount = static_cast<AmSize>(std::ceil(static_cast<float>(irLen) / static_cast<float>(_blockSize)));
-        _fftComplexSize = FFT::GetOutputSize(_segSize);
 
         // FFT
-        _fft.Initialize(_segSize);
-        _fftBuffer.Resize(_segSize);
+        _fft = PFFFTSetupCache::Acquire(_segSize);
+        if (_fft == nullptr)
+        {
+            Reset();
+            return false;
+        }
 
-        // Prepare segments
-        for (AmSize i = 0; i < _segCount; ++i)
-            _segments.push_back(ampoolnew(MemoryPoolKind::Filtering, SplitComplex, _fftComplexSize));
+        // Impulse response segments, followed by the input segments and the convolution buffers
+        AmReal32Buffer segmentsIR = AllocateBuffers(_segCount);
+        _segmentsIR = segmentsIR;
 
         // Prepare IR
         for (AmSize i = 0; i < _segCount; ++i)
         {
-            auto* segment = ampoolnew(MemoryPoolKind::Filtering, SplitComplex, _fftComplexSize);
             const AmSize remaining = irLen - (i * _blockSize);
             const AmSize sizeCopy = (remaining >= _blockSize) ? _blockSize : remaining;
-            CopyAndPad(_fftBuffer, &ir[i * _blockSize], sizeCopy);
-            _fft.Forward(_fftBuffer.GetBuffer(), *segment);
-            _segmentsIR.push_back(segment);
+            std::memcpy(_fftBuffer, &ir[i * _blockSize], sizeCopy * sizeof(AmAudioSample));
+            std::memset(_fftBuffer + sizeCopy, 0, (_segSize - sizeCopy) * sizeof(AmAudioSample));
+            pffft_transform(_fft, _fftBuffer, segmentsIR + i * _segSize, _work, PFFFT_FORWARD);
+        }
+
+        return true;
+    }
+
+    bool Convolver::Init(const Convolver& prototype)
+    {
+        Reset();
+
+        if (prototype._segCount == 0)
+            return true;
+
+        _blockSize = prototype._blockSize;
+        _segSize = prototype._segSize;
+        _segCount = prototype._segCount;
+
+        // FFT
+        _fft = PFFFTSetupCache::Acquire(_segSize);
+        if (_fft == nullptr)
+        {
+            Reset();
+            return false;
         }
 
+        AllocateBuffers(0);
+        _segmentsIR = prototype._segmentsIR;
+
+        return true;
+    }
+
+    AmReal32Buffer Convolver::AllocateBuffers(AmSize irSegCount)
+    {
+        const AmSize count = (irSegCount + _segCount + 4) * _segSize;
+
+        _data = static_cast<AmReal32Buffer>(ampoolmalign(MemoryPoolKind::Filtering, count * sizeof(AmReal32), kPFFFTAlignment));
+        std::memset(_data, 0, count * sizeof(AmReal32));
+
+        AmReal32Buffer segmentsIR = _data;
+        _segments = segmentsIR + irSegCount * _segSize;
+        _preMultiplied = _segments + _segCount * _segSize;
+        _conv = _preMultiplied + _segSize;
+        _fftBuffer = _conv + _segSize;
+        _work = _fftBuffer + _segSize;
+
         // Prepare convolution buffers
-        _preMultiplied.Resize(_fftComplexSize);
-        _conv.Resize(_fftComplexSize);
         _overlap.Resize(_blockSize);
+        _overlap.Clear();
 
         // Prepare input buffer
         _inputBuffer.Resize(_blockSize);
+        _inputBuffer.Clear();
         _inputBufferFill = 0;
 
         // Reset current position
         _current = 0;
 
-        return true;
+        return segmentsIR;
     }
 
     void Convolver::Process(const AmAudioSample* input, AmAudioSample* output, AmSize len)
@@ -130,6 +183,9 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
             return;
         }
 
+        // PFFFT transforms are not normalized
+        const AmReal32 scale = 1.0f / static_cast<AmReal32>(_segSize);
+
         AmSize processed = 0;
         while (processed < len)
         {
@@ -139,28 +195,31 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
             std::memcpy(_inputBuffer.GetBuffer() + inputBufferPos, input + processed, processing * sizeof(AmAudioSample));
 
             // Forward FFT
-            CopyAndPad(_fftBuffer, &_inputBuffer[0], _blockSize);
-            _fft.Forward(_fftBuffer.GetBuffer(), *_segments[_current]);
+            AmReal32Buffer segment = _segments + _current * _segSize;
+            std::memcpy(_fftBuffer, _inputBuffer.GetBuffer(), _blockSize * sizeof(AmAudioSample));
+            std::memset(_fftBuffer + _blockSize, 0, _blockSize * sizeof(AmAudioSample));
+            pffft_transform(_fft, _fftBuffer, segment, _work, PFFFT_FORWARD);
 
             // Complex multiplication
             if (inputBufferWasEmpty)
             {
-                _preMultiplied.Clear();
+                std::memset(_preMultiplied, 0, _segSize * sizeof(AmReal32));
                 for (AmSize i = 1; i < _segCount; ++i)
                 {
                     const AmSize indexIr = i;
                     const AmSize indexAudio = (_current + i) % _segCount;
-                    ComplexMultiplyAccumulate(_preMultiplied, *_segmentsIR[indexIr], *_segments[indexAudio]);
+                    pffft_zconvolve_accumulate(
+                        _fft, _segmentsIR + indexIr * _segSize, _segments + indexAudio * _segSize, _preMultiplied, scale);
                 }
             }
-            _conv.CopyFrom(_preMultiplied);
-            ComplexMultiplyAccumulate(_conv, *_segments[_current], *_segmentsIR[0]);
+            std::memcpy(_conv, _preMultiplied, _segSize * sizeof(AmReal32));
+            pffft_zconvolve_accumulate(_fft, segment, _segmentsIR, _conv, scale);
 
             // Backward FFT
-            _fft.Backward(_fftBuffer.GetBuffer(), _conv);
+            pffft_transform(_fft, _conv, _fftBuffer, _work, PFFFT_BACKWARD);
 
             // Add overlap
-            Sum(output + processed, _fftBuffer.GetBuffer() + inputBufferPos, _overlap.GetBuffer() + inputBufferPos, processing);
+            Sum(output + processed, _fftBuffer + inputBufferPos, _overlap.GetBuffer() + inputBufferPos, processing);
 
             // Input buffer full => Next block
             _inputBufferFill += processing;
@@ -171,7 +230,7 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
                 _inputBufferFill = 0;
 
                 // Save the overlap
-                std::memcpy(_overlap.GetBuffer(), _fftBuffer.GetBuffer() + _blockSize, _blockSize * sizeof(AmAudioSample));
+                std::memcpy(_overlap.GetBuffer(), _fftBuffer + _blockSize, _blockSize * sizeof(AmAudioSample));
 
                 // Update current segments
                 _current = (_current > 0) ? (_current - 1) : (_segCount - 1);
@@ -180,4 +239,4 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
             processed += processing;
         }
     }
-} // namespace SparkyStudios::Audio::Amplitude::Convolution
\ No newline at end of file
+} // namespace SparkyStudios::Audio::Amplitude::Convolution
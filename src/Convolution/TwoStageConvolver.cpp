@@ -32,12 +32,17 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
         , _tailOutput0()
         , _tailPrecalculated0()
         , _tailConvolver()
-        , _tailOutput()
         , _tailPrecalculated()
         , _tailInput()
         , _tailInputFill(0)
         , _precalculatedPos(0)
-        , _backgroundProcessingInput()
+        , _tailBlock(0)
+        , _backgroundInputs()
+        , _backgroundOutputs()
+        , _backgroundBlocks()
+        , _backgroundQueued(0)
+        , _backgroundProcessed(0)
+        , _backgroundSummed(0)
     {}
 
     TwoStageConvolver::~TwoStageConvolver()
@@ -54,13 +59,22 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
         _tailOutput0.Release();
         _tailPrecalculated0.Release();
         _tailConvolver.Reset();
-        _tailOutput.Release();
         _tailPrecalculated.Release();
         _tailInput.Release();
         _tailInputFill = 0;
-        _tailInputFill = 0;
         _precalculatedPos = 0;
-        _backgroundProcessingInput.Release();
+        _tailBlock = 0;
+
+        for (AmSize i = 0; i < kBackgroundBlocks; ++i)
+        {
+            _backgroundInputs[i].Release();
+            _backgroundOutputs[i].Release();
+            _backgroundBlocks[i] = 0;
+        }
+
+        _backgroundQueued.store(0, std::memory_order_relaxed);
+        _backgroundProcessed.store(0, std::memory_order_relaxed);
+        _backgroundSummed = 0;
     }
 
     bool TwoStageConvolver::Init(AmSize headBlockSize, AmSize tailBlockSize, const AmAudioSample* ir, AmSize irLen)
@@ -90,30 +104,79 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
         const AmSize headIrLen = std::min(irLen, _tailBlockSize);
         _headConvolver.Init(_headBlockSize, ir, headIrLen);
 
+        // The first tail convolver covers two tail blocks, giving one more tail block of time to the background processing.
         if (irLen > _tailBlockSize)
         {
-            const AmSize conv1IrLen = std::min(irLen - _tailBlockSize, _tailBlockSize);
+            const AmSize conv1IrLen = std::min(irLen - _tailBlockSize, 2 * _tailBlockSize);
             _tailConvolver0.Init(_headBlockSize, ir + _tailBlockSize, conv1IrLen);
+        }
+
+        if (irLen > 3 * _tailBlockSize)
+        {
+            const AmSize tailIrLen = irLen - (3 * _tailBlockSize);
+            _tailConvolver.Init(_tailBlockSize, ir + (3 * _tailBlockSize), tailIrLen);
+        }
+
+        InitBuffers();
+
+        return true;
+    }
+
+    bool TwoStageConvolver::Init(const TwoStageConvolver& prototype)
+    {
+        Reset();
+
+        if (prototype._headBlockSize == 0)
+            return true;
+
+        _headBlockSize = prototype._headBlockSize;
+        _tailBlockSize = prototype._tailBlockSize;
+
+        bool success = _headConvolver.Init(prototype._headConvolver);
+        success = _tailConvolver0.Init(prototype._tailConvolver0) && success;
+        success = _tailConvolver.Init(prototype._tailConvolver) && success;
+
+        if (!success)
+        {
+            Reset();
+            return false;
+        }
+
+        InitBuffers();
+
+        return true;
+    }
+
+    void TwoStageConvolver::InitBuffers()
+    {
+        const bool hasTail0 = _tailConvolver0.HasImpulseResponse();
+        const bool hasTail = _tailConvolver.HasImpulseResponse();
+
+        if (hasTail0)
+        {
             _tailOutput0.Resize(_tailBlockSize);
+            _tailOutput0.Clear();
             _tailPrecalculated0.Resize(_tailBlockSize);
+            _tailPrecalculated0.Clear();
         }
 
-        if (irLen > 2 * _tailBlockSize)
+        if (hasTail)
         {
-            const AmSize tailIrLen = irLen - (2 * _tailBlockSize);
-            _tailConvolver.Init(_tailBlockSize, ir + (2 * _tailBlockSize), tailIrLen);
-            _tailOutput.Resize(_tailBlockSize);
             _tailPrecalculated.Resize(_tailBlockSize);
-            _backgroundProcessingInput.Resize(_tailBlockSize);
+            _tailPrecalculated.Clear();
+
+            for (AmSize i = 0; i < kBackgroundBlocks; ++i)
+            {
+                _backgroundInputs[i].Resize(_tailBlockSize);
+                _backgroundOutputs[i].Resize(_tailBlockSize);
+            }
         }
 
-        if (_tailPrecalculated0.GetSize() > 0 || _tailPrecalculated.GetSize() > 0)
+        if (hasTail0 || hasTail)
             _tailInput.Resize(_tailBlockSize);
 
         _tailInputFill = 0;
         _precalculatedPos = 0;
-
-        return true;
     }
 
     void TwoStageConvolver::Process(const AmAudioSample* input, AmAudioSample* output, AmSize len)
@@ -178,19 +241,16 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
                 }
 
                 // Convolution: 2nd-Nth tail block (might be done in some background thread)
-                if (_tailPrecalculated.GetSize() > 0 && _tailInputFill == _tailBlockSize &&
-                    _backgroundProcessingInput.GetSize() == _tailBlockSize && _tailOutput.GetSize() == _tailBlockSize)
+                if (_tailPrecalculated.GetSize() > 0 && _tailInputFill == _tailBlockSize)
                 {
-                    WaitForBackgroundProcessing();
-                    AmAlignedReal32Buffer::Swap(_tailPrecalculated, _tailOutput);
-                    _backgroundProcessingInput.CopyFrom(_tailInput);
-                    StartBackgroundProcessing();
+                    QueueBackgroundProcessing();
                 }
 
                 if (_tailInputFill == _tailBlockSize)
                 {
                     _tailInputFill = 0;
                     _precalculatedPos = 0;
+                    ++_tailBlock;
                 }
 
                 processed += processing;
@@ -198,16 +258,64 @@ namespace SparkyStudios::Audio::Amplitude::Convolution
         }
     }
 
+    void TwoStageConvolver::QueueBackgroundProcessing()
+    {
+        const AmUInt64 queued = _backgroundQueued.load(std::memory_order_relaxed);
+        const AmUInt64 processed = _backgroundProcessed.load(std::memory_order_acquire);
+
+        // The tail block queued two tail blocks ago is summed during the next one.
+        bool summed = false;
+        while (_backgroundSummed < queued)
+        {
+            const AmSize slot = _backgroundSummed % kBackgroundBlocks;
+            if (_backgroundBlocks[slot] + 2 > _tailBlock)
+                break;
+
+            if (_backgroundBlocks[slot] + 2 == _tailBlock && _backgroundSummed < processed)
+            {
+                std::memcpy(
+                    _tailPrecalculated.GetBuffer(), _backgroundOutputs[slot].GetBuffer(), _tailBlockSize * sizeof(AmAudioSample));
+                summed = true;
+            }
+
+            ++_backgroundSummed;
+        }
+
+        // The background processing is late, this part of the tail is dropped.
+        if (!summed)
+            _tailPrecalculated.Clear();
+
+        // A slot is reused once the tail block it held is processed. Otherwise, the current tail block is dropped.
+        if (queued - processed < kBackgroundBlocks)
+        {
+            const AmSize slot = queued % kBackgroundBlocks;
+            std::memcpy(_backgroundInputs[slot].GetBuffer(), _tailInput.GetBuffer(), _tailBlockSize * sizeof(AmAudioSample));
+            _backgroundBlocks[slot] = _tailBlock;
+            _backgroundQueued.store(queued + 1, std::memory_order_release);
+
+            StartBackgroundProcessing();
+        }
+    }
+
     void TwoStageConvolver::StartBackgroundProcessing()
     {
         DoBackgroundProcessing();
     }
 
-    void TwoStageConvolver::WaitForBackgroundProcessing()
-    {}
-
     void TwoStageConvolver::DoBackgroundProcessing()
     {
-        _tailConvolver.Process(_backgroundProcessingInput.GetBuffer(), _tailOutput.GetBuffer(), _tailBlockSize);
+        const AmUInt64 queued = _backgroundQueued.load(std::memory_order_acquire);
+
+        for (AmUInt64 i = _backgroundProcessed.load(std::memory_order_relaxed); i < queued; ++i)
+        {
+            const AmSize slot = i % kBackgroundBlocks;
+            _tailConvolver.Process(_backgroundInputs[slot].GetBuffer(), _backgroundOutputs[slot].GetBuffer(), _tailBlockSize);
+            _backgroundProcessed.store(i + 1, std::memory_order_release);
+        }
+    }
+
+    bool TwoStageConvolver::HasBackgroundProcessing() const
+    {
+        return _backgroundProcessed.load(std::memory_order_acquire) < _backgroundQueued.load(std::memory_order_acquire);
     }
 } // namespace SparkyStudios::Audio::Amplitude::Convolution
@@ -50,6 +50,7 @@ namespace SparkyStudios::Audio::Amplitude
     {
         Fader::Destruct(_faderName, _fader);
 
+        _realChannel.CancelPending();
         _realChannel._channelLayersId.clear();
         _realChannel._activeSounds.clear();
         _realChannel._playedSounds.clear();
@@ -638,7 +639,7 @@ namespace SparkyStudios::Audio::Amplitude
             break;
         case ChannelPlaybackState::FadingIn:
         case ChannelPlaybackState::Playing:
-            if (IsReal() && !_realChannel.Playing())
+            if (IsReal() && (!_realChannel.Update() || !_realChannel.Playing()))
             {
                 _channelState = ChannelPlaybackState::Stopped;
             }
@@ -40,12 +40,97 @@ namespace SparkyStudios::Audio::Amplitude
         return c;
     }
 
+    // The default number of decoders kept by each codec for reuse.
+    constexpr AmSize kDefaultDecoderPoolSize = 8;
+
     Codec::Codec(AmString name)
         : m_name(std::move(name))
+        , _decoderPool()
+        , _decoderPoolSize(kDefaultDecoderPoolSize)
+        , _decoderPoolMutex(Thread::CreateMutex())
     {
         Register(this);
     }
 
+    Codec::~Codec()
+    {
+        // Pooled decoders must have been destroyed by Release().
+        AMPLITUDE_ASSERT(_decoderPool.empty());
+
+        Thread::DestroyMutex(_decoderPoolMutex);
+        _decoderPoolMutex = nullptr;
+    }
+
+    Codec::Decoder* Codec::AcquireDecoder()
+    {
+        Thread::LockMutex(_decoderPoolMutex);
+
+        if (!_decoderPool.empty())
+        {
+            Decoder* decoder = _decoderPool.back();
+            _decoderPool.pop_back();
+
+            Thread::UnlockMutex(_decoderPoolMutex);
+            return decoder;
+        }
+
+        Thread::UnlockMutex(_decoderPoolMutex);
+        return CreateDecoder();
+    }
+
+    void Codec::ReleaseDecoder(Decoder* decoder)
+    {
+        if (decoder == nullptr)
+            return;
+
+        decoder->Close();
+
+        Thread::LockMutex(_decoderPoolMutex);
+
+        if (_decoderPool.size() < _decoderPoolSize)
+        {
+            _decoderPool.push_back(decoder);
+
+            Thread::UnlockMutex(_decoderPoolMutex);
+            return;
+        }
+
+        Thread::UnlockMutex(_decoderPoolMutex);
+        DestroyDecoder(decoder);
+    }
+
+    void Codec::SetDecoderPoolSize(AmSize size)
+    {
+        Thread::LockMutex(_decoderPoolMutex);
+
+        _decoderPoolSize = size;
+
+        std::vector<Decoder*> extra;
+        while (_decoderPool.size() > _decoderPoolSize)
+        {
+            extra.push_back(_decoderPool.back());
+            _decoderPool.pop_back();
+        }
+
+        Thread::UnlockMutex(_decoderPoolMutex);
+
+        for (Decoder* decoder : extra)
+            DestroyDecoder(decoder);
+    }
+
+    void Codec::Release()
+    {
+        Thread::LockMutex(_decoderPoolMutex);
+
+        std::vector<Decoder*> pool;
+        pool.swap(_decoderPool);
+
+        Thread::UnlockMutex(_decoderPoolMutex);
+
+        for (Decoder* decoder : pool)
+            DestroyDecoder(decoder);
+    }
+
     void Codec::Register(Codec* codec)
     {
         if (lockCodecs())
@@ -84,4 +169,9 @@ namespace SparkyStudios::Audio::Amplitude
     {
         lockCodecs() = true;
     }
+
+    const std::map<AmString, Codec*>& Codec::GetRegistry()
+    {
+        return codecRegistry();
+    }
 } // namespace SparkyStudios::Audio::Amplitude
\ No newline at end of file
@@ -276,7 +276,10 @@ namespace SparkyStudios::Audio::Amplitude
             }
         }
 
-        format.SetAll(sample_rate, num_channels, bits_per_sample, num_samples, num_channels * sizeof(AmInt16), AM_SAMPLE_FORMAT_INT);
+        format.SetAll(
+            sample_rate, num_channels, bits_per_sample, num_samples, num_channels * sizeof(AmAudioSample),
+            AM_SAMPLE_FORMAT_FLOAT // This codec always read frames as float32 values
+        );
 
         blockSize = wave_header.head.blockAlign;
 
@@ -364,45 +367,6 @@ namespace SparkyStudios::Audio::Amplitude
         return file->Write((AmConstUInt8Buffer)&header, sizeof(header));
     }
 
-    static AmUInt64 Decode(
-        std::shared_ptr<File> file, const SoundFormat& format, AmVoidPtr out, AmUInt64 offset, AmUInt64 length, AmUInt32 blockSize)
-    {
-        const AmUInt32 numChannels = format.GetNumChannels();
-        const AmUInt32 frameSize = format.GetFrameSize();
-        const AmUInt32 samplesPerBlock = (blockSize - numChannels * 4) * (numChannels ^ 3) + 1;
-
-        auto pcm_block = static_cast<AmInt16Buffer>(ampoolmalloc(MemoryPoolKind::Codec, samplesPerBlock * frameSize));
-        auto adpcm_block = static_cast<AmUInt8Buffer>(ampoolmalloc(MemoryPoolKind::Codec, blockSize));
-
-        if (!pcm_block || !adpcm_block)
-        {
-            return 0;
-        }
-
-        if (file->Read(adpcm_block, blockSize) != blockSize)
-        {
-            ampoolfree(MemoryPoolKind::Codec, pcm_block);
-            ampoolfree(MemoryPoolKind::Codec, adpcm_block);
-            return 0;
-        }
-
-        if (Decompress(pcm_block, adpcm_block, blockSize, numChannels) != samplesPerBlock)
-        {
-            ampoolfree(MemoryPoolKind::Codec, pcm_block);
-            ampoolfree(MemoryPoolKind::Codec, adpcm_block);
-            return 0;
-        }
-
-        const AmUInt64 oo = (offset % blockSize) * numChannels;
-
-        memcpy(out, pcm_block + oo, length * frameSize);
-
-        ampoolfree(MemoryPoolKind::Codec, pcm_block);
-        ampoolfree(MemoryPoolKind::Codec, adpcm_block);
-
-        return length;
-    }
-
     static AmUInt64 Encode(
         std::shared_ptr<File> file,
         SoundFormat& format,
@@ -507,10 +471,27 @@ namespace SparkyStudios::Audio::Amplitude
         return offset;
     }
 
+    // The number of complete blocks decoded together when loading a whole file.
+    constexpr AmUInt64 kLoadBlocksCount = 16;
+
     AMSCodec::AMSCodec()
         : Codec("ams")
     {}
 
+    AMSCodec::AMSDecoder::~AMSDecoder()
+    {
+        Close();
+
+        if (_adpcmBlock != nullptr)
+            ampoolfree(MemoryPoolKind::Codec, _adpcmBlock);
+
+        if (_pcmBlock != nullptr)
+            ampoolfree(MemoryPoolKind::Codec, _pcmBlock);
+
+        _adpcmBlock = nullptr;
+        _pcmBlock = nullptr;
+    }
+
     bool AMSCodec::AMSDecoder::Open(std::shared_ptr<File> file)
     {
         _file = file;
@@ -521,6 +502,46 @@ namespace SparkyStudios::Audio::Amplitude
             return false;
         }
 
+        const AmUInt32 numChannels = m_format.GetNumChannels();
+
+        // The header is parsed up to the beginning of the data chunk.
+        _dataOffset = _file->Position();
+        _samplesPerBlock = (_blockSize - numChannels * 4) * (numChannels ^ 3) + 1;
+
+        // Buffers from a previously opened file are reused when they are large enough.
+        if (_adpcmBlockSize < _blockSize)
+        {
+            if (_adpcmBlock != nullptr)
+                ampoolfree(MemoryPoolKind::Codec, _adpcmBlock);
+
+            _adpcmBlock = static_cast<AmUInt8Buffer>(ampoolmalloc(MemoryPoolKind::Codec, _blockSize));
+            _adpcmBlockSize = _adpcmBlock != nullptr ? _blockSize : 0;
+        }
+
+        if (const AmSize pcmBlockSize = _samplesPerBlock * numChannels * sizeof(AmAudioSample); _pcmBlockSize < pcmBlockSize)
+        {
+            if (_pcmBlock != nullptr)
+                ampoolfree(MemoryPoolKind::Codec, _pcmBlock);
+
+            _pcmBlock = static_cast<AmAudioSampleBuffer>(ampoolmalloc(MemoryPoolKind::Codec, pcmBlockSize));
+            _pcmBlockSize = _pcmBlock != nullptr ? pcmBlockSize : 0;
+        }
+
+        if (_adpcmBlock == nullptr || _pcmBlock == nullptr)
+        {
+            CallLogFunc("[ERROR] Unable to allocate the decoding buffers of the file: '" AM_OS_CHAR_FMT "'\n", file->GetPath().c_str());
+
+            _file.reset();
+            m_format = SoundFormat();
+
+            return false;
+        }
+
+        m_cursor = 0;
+        _fileBlock = 0;
+        _decodedBlock = kInvalidBlock;
+        _decodedFrames = 0;
+
         _initialized = true;
 
         return true;
@@ -545,10 +566,45 @@ namespace SparkyStudios::Audio::Amplitude
         if (!_initialized)
             return 0;
 
-        if (!Seek(0))
-            return 0;
+        const AmUInt32 numChannels = m_format.GetNumChannels();
+        const AmUInt64 framesCount = m_format.GetFramesCount();
+        const AmUInt64 completeBlocks = framesCount / _samplesPerBlock;
+
+        auto* output = static_cast<AmAudioSampleBuffer>(out);
+
+        // Complete blocks are decoded straight into the output, several at a time.
+        if (completeBlocks > 0)
+        {
+            auto* blocks = static_cast<AmUInt8Buffer>(ampoolmalloc(MemoryPoolKind::Codec, kLoadBlocksCount * _blockSize));
+            if (blocks == nullptr)
+                return 0;
+
+            _file->Seek(_dataOffset, SEEK_SET);
+
+            for (AmUInt64 block = 0, count; block < completeBlocks; block += count)
+            {
+                count = AM_MIN(kLoadBlocksCount, completeBlocks - block);
+                const AmSize size = count * _blockSize;
+
+                if (_file->Read(blocks, size) != size ||
+                    DecompressBlocks(output + block * _samplesPerBlock * numChannels, blocks, _blockSize, count, numChannels) == 0)
+                {
+                    ampoolfree(MemoryPoolKind::Codec, blocks);
+
+                    _fileBlock = kInvalidBlock;
+                    return 0;
+                }
+            }
+
+            ampoolfree(MemoryPoolKind::Codec, blocks);
+
+            _fileBlock = completeBlocks;
+        }
+
+        m_cursor = completeBlocks * _samplesPerBlock;
 
-        return Decode(_file, m_format, out, 0, m_format.GetFramesCount(), _blockSize);
+        // Decode the last, incomplete block if any.
+        return m_cursor + Stream(output + m_cursor * numChannels, m_cursor, framesCount - m_cursor);
     }
 
     AmUInt64 AMSCodec::AMSDecoder::Stream(AmVoidPtr out, AmUInt64 offset, AmUInt64 length)
@@ -556,20 +612,71 @@ namespace SparkyStudios::Audio::Amplitude
         if (!_initialized)
             return 0;
 
-        if (!Seek(offset))
+        if (offset != m_cursor && !Seek(offset))
             return 0;
 
-        return Decode(_file, m_format, out, offset, length, _blockSize);
+        const AmUInt32 numChannels = m_format.GetNumChannels();
+        const AmUInt64 framesCount = m_format.GetFramesCount();
+
+        auto* output = static_cast<AmAudioSampleBuffer>(out);
+        AmUInt64 read = 0;
+
+        while (read < length && m_cursor < framesCount)
+        {
+            const AmUInt64 block = m_cursor / _samplesPerBlock;
+
+            if (block != _decodedBlock && !DecodeBlock(block))
+                break;
+
+            const AmUInt64 blockOffset = m_cursor - block * _samplesPerBlock;
+            if (blockOffset >= _decodedFrames)
+                break;
+
+            const AmUInt64 frames = AM_MIN(length - read, _decodedFrames - blockOffset);
+
+            std::memcpy(output + read * numChannels, _pcmBlock + blockOffset * numChannels, frames * numChannels * sizeof(AmAudioSample));
+
+            read += frames;
+            m_cursor += frames;
+        }
+
+        return read;
     }
 
     bool AMSCodec::AMSDecoder::Seek(AmUInt64 offset)
+    {
+        if (offset > m_format.GetFramesCount())
+            return false;
+
+        // The file is repositioned when the block at this offset is decoded.
+        m_cursor = offset;
+
+        return true;
+    }
+
+    bool AMSCodec::AMSDecoder::DecodeBlock(AmUInt64 block)
     {
         const AmUInt32 numChannels = m_format.GetNumChannels();
-        const AmUInt32 samplesPerBlock = (_blockSize - numChannels * 4) * (numChannels ^ 3) + 1;
-        const AmUInt32 steps = offset / samplesPerBlock;
 
-        offset = steps * _blockSize;
-        _file->Seek(sizeof(ADPCMHeader) + offset, SEEK_SET);
+        if (block != _fileBlock)
+            _file->Seek(_dataOffset + block * _blockSize, SEEK_SET);
+
+        // The last block of the file may be shorter than the others.
+        const AmSize size = _file->Read(_adpcmBlock, _blockSize);
+        _fileBlock = block + 1;
+
+        // Complete blocks take the SIMD path, which decodes the channels of the block in parallel lanes.
+        const AmInt64 frames = size == _blockSize ? static_cast<AmInt64>(DecompressBlocks(_pcmBlock, _adpcmBlock, size, 1, numChannels))
+                                                  : Decompress(_pcmBlock, _adpcmBlock, size, numChannels);
+        if (frames <= 0)
+        {
+            _decodedBlock = kInvalidBlock;
+            _decodedFrames = 0;
+            return false;
+        }
+
+        _decodedBlock = block;
+        _decodedFrames = AM_MIN(static_cast<AmUInt64>(frames), m_format.GetFramesCount() - block * _samplesPerBlock);
 
         return true;
     }
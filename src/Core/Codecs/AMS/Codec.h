@@ -34,8 +34,19 @@ namespace SparkyStudios::Audio::Amplitude
                 , _initialized(false)
                 , _file()
                 , _blockSize(0)
+                , _samplesPerBlock(0)
+                , _dataOffset(0)
+                , _adpcmBlock(nullptr)
+                , _adpcmBlockSize(0)
+                , _pcmBlock(nullptr)
+                , _pcmBlockSize(0)
+                , _fileBlock(0)
+                , _decodedBlock(kInvalidBlock)
+                , _decodedFrames(0)
             {}
 
+            ~AMSDecoder() override;
+
             bool Open(std::shared_ptr<File> file) override;
 
             bool Close() override;
@@ -47,9 +58,36 @@ namespace SparkyStudios::Audio::Amplitude
             bool Seek(AmUInt64 offset) override;
 
         private:
+            static constexpr AmUInt64 kInvalidBlock = static_cast<AmUInt64>(-1);
+
+            /**
+             * @brief Reads and decompresses the given block into the PCM block buffer.
+             *
+             * @param block The index of the block to decode.
+             *
+             * @return true if the block was decoded, false otherwise.
+             */
+            bool DecodeBlock(AmUInt64 block);
+
             bool _initialized;
             std::shared_ptr<File> _file;
             AmUInt16 _blockSize;
+            AmUInt32 _samplesPerBlock;
+            AmSize _dataOffset;
+
+            // Buffers reused for each block, allocated when the file is opened and kept
+            // after it's closed, so they can be reused when the decoder is reset.
+            AmUInt8Buffer _adpcmBlock;
+            AmSize _adpcmBlockSize;
+            AmAudioSampleBuffer _pcmBlock;
+            AmSize _pcmBlockSize;
+
+            // The index of the block at the current position of the file.
+            AmUInt64 _fileBlock;
+
+            // The index of the block currently held in the PCM block buffer.
+            AmUInt64 _decodedBlock;
+            AmUInt64 _decodedFrames;
         };
 
         class AMSEncoder final : public Encoder
@@ -19,6 +19,9 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    // The approximate duration in seconds between two seek points.
+    constexpr AmUInt32 kSeekPointInterval = 1;
+
     static void* onMalloc(size_t sz, void* pUserData)
     {
         return ampoolmalloc(MemoryPoolKind::Codec, sz);
@@ -85,6 +88,22 @@ namespace SparkyStudios::Audio::Amplitude
             AM_SAMPLE_FORMAT_FLOAT // This codec always read frames as float32 values
         );
 
+        // Build the seek table, so seeking doesn't need to decode the file from the start.
+        auto seekPointCount = static_cast<drmp3_uint32>(AM_MAX(1, framesCount / (_mp3.sampleRate * kSeekPointInterval)));
+        _seekPoints.resize(seekPointCount);
+
+        if (drmp3_calculate_seek_points(&_mp3, &seekPointCount, _seekPoints.data()) == DRMP3_TRUE)
+        {
+            _seekPoints.resize(seekPointCount);
+            drmp3_bind_seek_table(&_mp3, seekPointCount, _seekPoints.data());
+        }
+        else
+        {
+            CallLogFunc("[WARNING] Unable to build the seek table of the MP3 file: '" AM_OS_CHAR_FMT "'\n", file->GetPath().c_str());
+            _seekPoints.clear();
+        }
+
+        m_cursor = 0;
         _initialized = true;
 
         return true;
@@ -99,6 +118,9 @@ namespace SparkyStudios::Audio::Amplitude
             m_format = SoundFormat();
             _initialized = false;
             drmp3_uninit(&_mp3);
+
+            _seekPoints.clear();
+            m_cursor = 0;
         }
 
         // true because it is already closed
@@ -106,30 +128,40 @@ namespace SparkyStudios::Audio::Amplitude
     }
 
     AmUInt64 MP3Codec::MP3Decoder::Load(AmVoidPtr out)
+    {
+        return Stream(out, 0, m_format.GetFramesCount());
+    }
+
+    AmUInt64 MP3Codec::MP3Decoder::Stream(AmVoidPtr out, AmUInt64 offset, AmUInt64 length)
     {
         if (!_initialized)
             return 0;
 
-        if (!Seek(0))
+        // Sequential reads continue from the current position without seeking.
+        if (offset != m_cursor && !Seek(offset))
             return 0;
 
-        return drmp3_read_pcm_frames_f32(&_mp3, m_format.GetFramesCount(), static_cast<AmAudioSampleBuffer>(out));
+        return StreamNext(out, length);
     }
 
-    AmUInt64 MP3Codec::MP3Decoder::Stream(AmVoidPtr out, AmUInt64 offset, AmUInt64 length)
+    AmUInt64 MP3Codec::MP3Decoder::StreamNext(AmVoidPtr out, AmUInt64 length)
     {
         if (!_initialized)
             return 0;
 
-        if (!Seek(offset))
-            return 0;
+        const AmUInt64 read = drmp3_read_pcm_frames_f32(&_mp3, length, static_cast<AmAudioSampleBuffer>(out));
+        m_cursor += read;
 
-        return drmp3_read_pcm_frames_f32(&_mp3, length, static_cast<AmAudioSampleBuffer>(out));
+        return read;
     }
 
     bool MP3Codec::MP3Decoder::Seek(AmUInt64 offset)
     {
-        return drmp3_seek_to_pcm_frame(&_mp3, offset) == DRMP3_TRUE;
+        if (drmp3_seek_to_pcm_frame(&_mp3, offset) != DRMP3_TRUE)
+            return false;
+
+        m_cursor = offset;
+        return true;
     }
 
     bool MP3Codec::MP3Encoder::Open(std::shared_ptr<File> file)
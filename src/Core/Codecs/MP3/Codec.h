@@ -17,6 +17,8 @@
 #ifndef SS_AMPLITUDE_AUDIO_MP3_CODEC_H
 #define SS_AMPLITUDE_AUDIO_MP3_CODEC_H
 
+#include <vector>
+
 #include <SparkyStudios/Audio/Amplitude/Amplitude.h>
 
 #include "dr_mp3.h"
@@ -33,6 +35,7 @@ namespace SparkyStudios::Audio::Amplitude
                 : Decoder(codec)
                 , _initialized(false)
                 , _mp3()
+                , _seekPoints()
             {}
 
             bool Open(std::shared_ptr<File> file) override;
@@ -43,12 +46,17 @@ namespace SparkyStudios::Audio::Amplitude
 
             AmUInt64 Stream(AmVoidPtr out, AmUInt64 offset, AmUInt64 length) override;
 
+            AmUInt64 StreamNext(AmVoidPtr out, AmUInt64 length) override;
+
             bool Seek(AmUInt64 offset) override;
 
         private:
             std::shared_ptr<File> _file;
             bool _initialized;
             drmp3 _mp3;
+
+            // Seek points built when the file is opened, bound to the decoder.
+            std::vector<drmp3_seek_point> _seekPoints;
         };
 
         class MP3Encoder final : public Encoder
@@ -84,6 +84,7 @@ namespace SparkyStudios::Audio::Amplitude
             AM_SAMPLE_FORMAT_FLOAT // This codec always read frames as float32 values
         );
 
+        m_cursor = 0;
         _initialized = true;
 
         return true;
@@ -97,6 +98,7 @@ namespace SparkyStudios::Audio::Amplitude
 
             m_format = SoundFormat();
             _initialized = false;
+            m_cursor = 0;
 
             return drwav_uninit(&_wav) == DRWAV_SUCCESS;
         }
@@ -106,30 +108,45 @@ namespace SparkyStudios::Audio::Amplitude
     }
 
     AmUInt64 WAVCodec::WAVDecoder::Load(AmVoidPtr out)
+    {
+        return Stream(out, 0, m_format.GetFramesCount());
+    }
+
+    AmUInt64 WAVCodec::WAVDecoder::Stream(AmVoidPtr out, AmUInt64 offset, AmUInt64 length)
     {
         if (!_initialized)
             return 0;
 
-        if (!Seek(0))
+        // Sequential reads continue from the current position without seeking.
+        if (offset != m_cursor && !Seek(offset))
             return 0;
 
-        return drwav_read_pcm_frames_f32(&_wav, _wav.totalPCMFrameCount, static_cast<AmAudioSampleBuffer>(out));
+        return StreamNext(out, length);
     }
 
-    AmUInt64 WAVCodec::WAVDecoder::Stream(AmVoidPtr out, AmUInt64 offset, AmUInt64 length)
+    AmUInt64 WAVCodec::WAVDecoder::StreamNext(AmVoidPtr out, AmUInt64 length)
     {
         if (!_initialized)
             return 0;
 
-        if (!Seek(offset))
-            return 0;
+        const AmUInt64 read = drwav_read_pcm_frames_f32(&_wav, length, static_cast<AmAudioSampleBuffer>(out));
+        m_cursor += read;
 
-        return drwav_read_pcm_frames_f32(&_wav, length, static_cast<AmAudioSampleBuffer>(out));
+        return read;
     }
 
     bool WAVCodec::WAVDecoder::Seek(AmUInt64 offset)
     {
-        return drwav_seek_to_pcm_frame(&_wav, offset) == DRWAV_TRUE;
+        if (drwav_seek_to_pcm_frame(&_wav, offset) != DRWAV_TRUE)
+            return false;
+
+        m_cursor = offset;
+        return true;
+    }
+
+    bool WAVCodec::WAVDecoder::HasIntegerSamples() const
+    {
+        return _initialized && _wav.translatedFormatTag == DR_WAVE_FORMAT_PCM;
     }
 
     bool WAVCodec::WAVEncoder::Open(std::shared_ptr<File> file)
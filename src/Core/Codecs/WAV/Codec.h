@@ -43,8 +43,12 @@ namespace SparkyStudios::Audio::Amplitude
 
             AmUInt64 Stream(AmVoidPtr out, AmUInt64 offset, AmUInt64 length) override;
 
+            AmUInt64 StreamNext(AmVoidPtr out, AmUInt64 length) override;
+
             bool Seek(AmUInt64 offset) override;
 
+            [[nodiscard]] bool HasIntegerSamples() const override;
+
         private:
             std::shared_ptr<File> _file;
             bool _initialized;
@@ -38,6 +38,12 @@ namespace SparkyStudios::Audio::Amplitude
     typedef flatbuffers::Vector<uint64_t> BusIdList;
     typedef flatbuffers::Vector<flatbuffers::Offset<DuckBusDefinition>> DuckBusDefinitionList;
 
+    // The budget of the sound data cache when the engine config doesn't set it, as in the schema.
+    constexpr AmSize kDefaultSoundDataCacheBudget = 32 * 1024 * 1024;
+
+    // The number of background sound data loaders when the engine config doesn't set it, as in the schema.
+    constexpr AmUInt32 kDefaultSoundDataLoaderThreads = 1;
+
     // The list of loaded plugins.
     static std::vector<dylib*> gLoadedPlugins = {};
 
@@ -143,6 +149,10 @@ namespace SparkyStudios::Audio::Amplitude
 
         _audioDriver = nullptr;
 
+        // Destroy pooled decoders while their codecs are still alive
+        for (const auto& [_, codec] : Codec::GetRegistry())
+            codec->Release();
+
         for (const auto& plugin : gLoadedPlugins)
         {
             if (const auto unregisterFunc = plugin->get_function<bool()>("UnregisterPlugin"); !unregisterFunc())
@@ -323,6 +333,7 @@ namespace SparkyStudios::Audio::Amplitude
         ampooldelete(MemoryPoolKind::Engine, SCurveSmoothFader, sCurveSmoothFaderPlugin);
         ampooldelete(MemoryPoolKind::Engine, SCurveSharpFader, sCurveSharpFaderPlugin);
         // ---
+        sAMSCodecPlugin->Release();
         ampooldelete(MemoryPoolKind::Engine, AMSCodec, sAMSCodecPlugin);
         // ---
         ampooldelete(MemoryPoolKind::Engine, MiniAudioDriver, sMiniAudioDriverPlugin);
@@ -652,6 +663,22 @@ namespace SparkyStudios::Audio::Amplitude
         // Environment Amounts
         _state->track_environments = config->game()->track_environments();
 
+        // Decoded sound data cache, with the default budget of the schema when the table is missing
+        const auto* cacheConfig = config->sound_data_cache();
+        _state->sound_data_cache.SetBudget(cacheConfig != nullptr ? cacheConfig->budget() : kDefaultSoundDataCacheBudget);
+
+        // Background decoding of sound data, with the defaults of the schema when the table is missing
+        if (const auto* loaderConfig = config->sound_data_loader(); loaderConfig != nullptr)
+        {
+            _state->sound_data_loader.Init(loaderConfig->threads());
+            _state->sound_data_max_latency = loaderConfig->max_latency();
+        }
+        else
+        {
+            _state->sound_data_loader.Init(kDefaultSoundDataLoaderThreads);
+            _state->sound_data_max_latency = 0;
+        }
+
         // Engine state
         _state->paused = false;
         _state->mute = false;
@@ -2285,6 +2312,9 @@ namespace SparkyStudios::Audio::Amplitude
             state.Update();
         }
 
+        // Environment effect instances are created and released here, out of the audio thread.
+        _state->mixer.UpdateEnvironmentBuses();
+
         for (auto&& state : _state->entity_list)
         {
             state.Update();
@@ -2396,6 +2426,11 @@ namespace SparkyStudios::Audio::Amplitude
         return _state->samples_per_stream;
     }
 
+    SoundDataCacheStats Engine::GetSoundDataCacheStats() const
+    {
+        return _state->sound_data_cache.GetStats();
+    }
+
     bool Engine::IsGameTrackingEnvironmentAmounts() const
     {
         return _state->track_environments;
@@ -27,6 +27,7 @@
 #include <Core/ListenerInternalState.h>
 
 #include <Mixer/Mixer.h>
+#include <Mixer/SoundDataCache.h>
 
 #include <Utils/intrusive_list.h>
 
@@ -103,6 +104,9 @@ namespace SparkyStudios::Audio::Amplitude
     {
         explicit EngineInternalState()
             : mixer(1.0f)
+            , sound_data_cache()
+            , sound_data_loader()
+            , sound_data_max_latency(0)
             , buses_source()
             , buses()
             , master_bus(nullptr)
@@ -123,6 +127,7 @@ namespace SparkyStudios::Audio::Amplitude
             , switch_id_map()
             , sound_bank_id_map()
             , sound_bank_map()
+            , asset_maps_mutex(Thread::CreateMutex())
             , channel_state_memory()
             , playing_channel_list(&ChannelInternalState::priority_node)
             , real_channel_free_list(&ChannelInternalState::free_node)
@@ -149,8 +154,23 @@ namespace SparkyStudios::Audio::Amplitude
             , version(nullptr)
         {}
 
+        ~EngineInternalState()
+        {
+            Thread::DestroyMutex(asset_maps_mutex);
+            asset_maps_mutex = nullptr;
+        }
+
         Mixer mixer;
 
+        // Keeps the decoded data of sounds which are no longer playing.
+        SoundDataCache sound_data_cache;
+
+        // Decodes the data of non-streamed sounds in the background.
+        Thread::Pool sound_data_loader;
+
+        // The maximum time in milliseconds a sound can wait for its data to be decoded.
+        AmUInt64 sound_data_max_latency;
+
         // Hold the audio buses definition file contents.
         std::string buses_source;
 
@@ -229,6 +249,9 @@ namespace SparkyStudios::Audio::Amplitude
         // Hold the sounds banks.
         SoundBankMap sound_bank_map;
 
+        // Guards the insertions in the asset maps while the definitions of sound banks are loaded in parallel.
+        AmMutexHandle asset_maps_mutex;
+
         // The pre-allocated pool of all ChannelInternalState objects
         ChannelStateVector channel_state_memory;
 
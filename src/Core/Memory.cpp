@@ -136,7 +136,11 @@ namespace SparkyStudios::Audio::Amplitude
         else
             ptr = mi_malloc(size);
 
-        _memAllocations.insert({ pool, ptr, mi_malloc_size(ptr), file, line });
+        {
+            std::lock_guard lock(_memAllocationsMutex);
+            _memAllocations.insert({ pool, ptr, mi_malloc_size(ptr), file, line });
+        }
+
         return ptr;
     }
 
@@ -154,7 +158,10 @@ namespace SparkyStudios::Audio::Amplitude
         else
             ptr = mi_malloc_aligned(size, alignment);
 
-        _memAllocations.insert({ pool, ptr, mi_malloc_size(ptr), file, line });
+        {
+            std::lock_guard lock(_memAllocationsMutex);
+            _memAllocations.insert({ pool, ptr, mi_malloc_size(ptr), file, line });
+        }
 
         return ptr;
     }
@@ -169,6 +176,18 @@ namespace SparkyStudios::Audio::Amplitude
 #endif
         }
 
+        // The previous address may be released by the reallocation, it's tracked again below if it's kept.
+        Allocation previous{ pool, address, 0, file, line };
+        if (address != nullptr)
+        {
+            std::lock_guard lock(_memAllocationsMutex);
+            if (const auto it = _memAllocations.find(previous); it != _memAllocations.end())
+            {
+                previous = *it;
+                _memAllocations.erase(it);
+            }
+        }
+
         AmVoidPtr ptr;
 
         if (_config.realloc != nullptr)
@@ -176,7 +195,15 @@ namespace SparkyStudios::Audio::Amplitude
         else
             ptr = mi_realloc(address, size);
 
-        _memAllocations.insert({ pool, ptr, mi_malloc_size(ptr), file, line });
+        {
+            std::lock_guard lock(_memAllocationsMutex);
+
+            // A failed reallocation leaves the previous block untouched.
+            if (ptr == nullptr && address != nullptr)
+                _memAllocations.insert(previous);
+            else
+                _memAllocations.insert({ pool, ptr, mi_malloc_size(ptr), file, line });
+        }
 
         return ptr;
     }
@@ -192,6 +219,18 @@ namespace SparkyStudios::Audio::Amplitude
 #endif
         }
 
+        // The previous address may be released by the reallocation, it's tracked again below if it's kept.
+        Allocation previous{ pool, address, 0, file, line };
+        if (address != nullptr)
+        {
+            std::lock_guard lock(_memAllocationsMutex);
+            if (const auto it = _memAllocations.find(previous); it != _memAllocations.end())
+            {
+                previous = *it;
+                _memAllocations.erase(it);
+            }
+        }
+
         AmVoidPtr ptr;
 
         if (_config.alignedRealloc != nullptr)
@@ -199,7 +238,15 @@ namespace SparkyStudios::Audio::Amplitude
         else
             ptr = mi_realloc_aligned(address, size, alignment);
 
-        _memAllocations.insert({ pool, ptr, mi_malloc_size(ptr), file, line });
+        {
+            std::lock_guard lock(_memAllocationsMutex);
+
+            // A failed reallocation leaves the previous block untouched.
+            if (ptr == nullptr && address != nullptr)
+                _memAllocations.insert(previous);
+            else
+                _memAllocations.insert({ pool, ptr, mi_malloc_size(ptr), file, line });
+        }
 
         return ptr;
     }
@@ -210,13 +257,17 @@ namespace SparkyStudios::Audio::Amplitude
         _memPoolsStats[pool].freeCount.fetch_add(1, std::memory_order_relaxed);
 #endif
 
+        // Stop tracking the address before releasing it, another thread may get it back from the allocator right after.
+        {
+            std::lock_guard lock(_memAllocationsMutex);
+            if (const auto it = _memAllocations.find({ pool, address }); it != _memAllocations.end())
+                _memAllocations.erase(it);
+        }
+
         if (_config.free != nullptr)
             _config.free(pool, address);
         else
             mi_free(address);
-
-        if (const auto it = _memAllocations.find({ pool, address }); it != _memAllocations.end())
-            _memAllocations.erase(it);
     }
 
     AmSize MemoryManager::TotalReservedMemorySize() const
@@ -224,6 +275,8 @@ namespace SparkyStudios::Audio::Amplitude
         if (_config.totalReservedMemorySize != nullptr)
             return _config.totalReservedMemorySize();
 
+        std::lock_guard lock(_memAllocationsMutex);
+
         AmSize total = 0;
         for (const auto& allocation : _memAllocations)
             total += allocation.size;
@@ -252,6 +305,8 @@ namespace SparkyStudios::Audio::Amplitude
 
     AmString MemoryManager::InspectMemoryLeaks() const
     {
+        std::lock_guard lock(_memAllocationsMutex);
+
         if (_memAllocations.empty())
             return "No memory leaks detected";
 
@@ -174,6 +174,7 @@ namespace SparkyStudios::Audio::Amplitude
         , m_dataSize(0)
         , m_offset(0)
         , m_dataOwned(false)
+        , m_filePath()
     {}
 
     MemoryFile::MemoryFile(AmUInt8Buffer buffer, AmSize size, bool copy, bool takeOwnership)
@@ -195,7 +196,7 @@ namespace SparkyStudios::Audio::Amplitude
 
     AmOsString MemoryFile::GetPath() const
     {
-        return AM_OS_STRING("");
+        return m_filePath;
     }
 
     bool MemoryFile::Eof()
@@ -267,6 +268,7 @@ namespace SparkyStudios::Audio::Amplitude
 
         m_dataPtr = nullptr;
         m_offset = 0;
+        m_filePath.clear();
 
         m_dataSize = size;
 
@@ -311,6 +313,7 @@ namespace SparkyStudios::Audio::Amplitude
 
         df.Read(m_dataPtr, m_dataSize);
         m_dataOwned = true;
+        m_filePath = fileName.native();
 
         df.Close();
 
@@ -339,6 +342,17 @@ namespace SparkyStudios::Audio::Amplitude
         file->Seek(m_offset, SEEK_SET);
 
         m_dataOwned = true;
+        m_filePath = file->GetPath();
+
+        return AM_ERROR_NO_ERROR;
+    }
+
+    AmResult MemoryFile::OpenShared(const MemoryFile& source)
+    {
+        if (const AmResult res = OpenMem(source.m_dataPtr, source.m_dataSize, false, false); res != AM_ERROR_NO_ERROR)
+            return res;
+
+        m_filePath = source.m_filePath;
 
         return AM_ERROR_NO_ERROR;
     }
@@ -30,7 +30,11 @@ namespace SparkyStudios::Audio::Amplitude
     constexpr AmUInt32 kProcessedFramesCount = 1;
 #endif // AM_SIMD_INTRINSICS
 
+    // Environment buses stop processing once their output stays below this level without any send for the configured tail time.
+    constexpr AmReal32 kEnvironmentBusSilenceThreshold = 1e-5f;
+
     static void OnSoundDestroyed(Mixer* mixer, MixerLayer* layer);
+    static void DestroyEnvironmentBus(EnvironmentBus* bus);
 
     static void* ma_malloc(size_t sz, void*)
     {
@@ -225,6 +229,10 @@ namespace SparkyStudios::Audio::Amplitude
         const auto* sound = layer->snd->sound.get();
         CallLogFunc("Stopped sound: " AM_OS_CHAR_FMT "\n", sound->GetSound()->GetPath().c_str());
 
+        // Clean up the pipeline
+        if (ProcessorPipeline* pipeline = mixer->GetPipeline(); pipeline != nullptr)
+            pipeline->Cleanup(layer->snd->sound.get());
+
         // Destroy the sound instance on stop
         OnSoundDestroyed(mixer, layer);
     }
@@ -321,6 +329,15 @@ namespace SparkyStudios::Audio::Amplitude
         layer->snd = nullptr;
     }
 
+    static void ReadSamples(const SoundChunk* chunk, AmUInt64 offset, AmUInt64 count, AmAudioSampleBuffer out)
+    {
+        // 16-bit samples are widened to float while being copied.
+        if (chunk->sampleFormat == AM_SAMPLE_FORMAT_INT)
+            ConvertInt16ToReal32(out, reinterpret_cast<const AmInt16*>(chunk->buffer) + offset, count);
+        else
+            std::memcpy(out, reinterpret_cast<const AmAudioSample*>(chunk->buffer) + offset, count * sizeof(AmAudioSample));
+    }
+
     static void MixMono(AmUInt64 index, const AmAudioFrame& gain, const SoundChunk* in, AmAudioFrameBuffer out)
     {
 #if defined(AM_SIMD_INTRINSICS)
@@ -366,6 +383,9 @@ namespace SparkyStudios::Audio::Amplitude
         , _layers()
         , _remainingFrames(0)
         , _pipeline(nullptr)
+        , _mixingLayer(nullptr)
+        , _environmentBuses()
+        , _environmentTailFrames(0)
         , _device()
     {
         AMPLIMIX_STORE(&_masterGain, masterGain);
@@ -389,6 +409,8 @@ namespace SparkyStudios::Audio::Amplitude
         _device.mRequestedOutputChannels = static_cast<PlaybackOutputChannels>(config->output()->channels());
         _device.mRequestedOutputFormat = static_cast<PlaybackOutputFormat>(config->output()->format());
 
+        _environmentTailFrames = static_cast<AmUInt64>(config->mixer()->environment_tail() * _device.mRequestedOutputSampleRate);
+
         _audioThreadMutex = Thread::CreateMutex(500);
 
         if (const auto* pipeline = config->mixer()->pipeline(); pipeline != nullptr && pipeline->size() > 0)
@@ -467,9 +489,24 @@ namespace SparkyStudios::Audio::Amplitude
 
         _audioThreadMutex = nullptr;
 
+        // Sounds still in a layer are destroyed after the pipeline, release their processor states first.
+        if (_pipeline != nullptr)
+        {
+            for (auto& layer : _layers)
+            {
+                if (layer.snd != nullptr && layer.snd->sound != nullptr)
+                    _pipeline->Cleanup(layer.snd->sound.get());
+            }
+        }
+
         ampooldelete(MemoryPoolKind::Amplimix, ProcessorPipeline, _pipeline);
         _pipeline = nullptr;
 
+        for (auto&& [id, bus] : _environmentBuses)
+            DestroyEnvironmentBus(bus);
+
+        _environmentBuses.clear();
+
         for (auto& layer : _layers)
             layer.Reset();
     }
@@ -545,6 +582,10 @@ namespace SparkyStudios::Audio::Amplitude
             }
         }
 
+        // Environment effects keep mixing their tails after the sounds inside them have stopped.
+        if (MixEnvironments(reinterpret_cast<AmAudioSampleBuffer>(align->buffer), frames))
+            hasMixedAtLeastOneLayer = true;
+
         if (!hasMixedAtLeastOneLayer)
             goto Cleanup;
 
@@ -561,6 +602,114 @@ namespace SparkyStudios::Audio::Amplitude
         return frameCount;
     }
 
+    static EnvironmentBus* CreateEnvironmentBus(Effect* effect, AmUInt32 length)
+    {
+        auto* bus = ampoolnew(MemoryPoolKind::Amplimix, EnvironmentBus);
+        bus->effect = effect;
+        bus->effect->GetRefCounter()->Increment();
+        bus->instance = effect->CreateInstance();
+        bus->buffer.Init(length);
+
+        return bus;
+    }
+
+    static void DestroyEnvironmentBus(EnvironmentBus* bus)
+    {
+        bus->effect->DestroyInstance(bus->instance);
+        bus->effect->GetRefCounter()->Decrement();
+        ampooldelete(MemoryPoolKind::Amplimix, EnvironmentBus, bus);
+    }
+
+    void Mixer::SendToEnvironment(
+        AmEnvironmentID environment, const Effect* effect, AmConstAudioSampleBuffer in, AmUInt64 frames, AmReal32 level)
+    {
+        if (effect == nullptr || level <= 0.0f)
+            return;
+
+        // The bus of a new environment effect is created at the next frame update.
+        const auto it = _environmentBuses.find(environment);
+        if (it == _environmentBuses.end() || it->second->effect != effect)
+            return;
+
+        const auto numChannels = static_cast<AmUInt16>(_device.mRequestedOutputChannels);
+        const AmUInt64 length = frames * numChannels;
+
+        EnvironmentBus* bus = it->second;
+        if (length > bus->buffer.GetSize())
+            return;
+
+        // First send of this mix
+        if (!bus->active)
+        {
+            std::memset(bus->buffer.GetBuffer(), 0, length * sizeof(AmReal32));
+            bus->active = true;
+            bus->silent = false;
+            bus->silentFrames = 0;
+        }
+
+        if (_mixingLayer != nullptr)
+        {
+            // The layer gain is panned with a constant power law, so its magnitude is the gain of the sound.
+            const AmVec2 g = AMPLIMIX_LOAD(&_mixingLayer->gain);
+            level *= std::sqrt(g.X * g.X + g.Y * g.Y);
+        }
+
+        AmReal32Buffer send = bus->buffer.GetBuffer();
+        for (AmUInt64 i = 0; i < length; ++i)
+            send[i] += in[i] * level;
+    }
+
+    void Mixer::UpdateEnvironmentBuses()
+    {
+        if (!_initialized)
+            return;
+
+        // The mixer is never asked for more frames than the output buffer size.
+        const AmUInt32 length = _device.mOutputBufferSize * static_cast<AmUInt32>(_device.mRequestedOutputChannels);
+
+        std::vector<std::pair<AmEnvironmentID, EnvironmentBus*>> created;
+        std::vector<EnvironmentBus*> released;
+
+        for (auto&& state : amEngine->GetState()->environment_list)
+        {
+            const Effect* effect = state.GetEffect();
+            if (effect == nullptr)
+                continue;
+
+            if (const auto it = _environmentBuses.find(state.GetId()); it != _environmentBuses.end() && it->second->effect == effect)
+                continue;
+
+            Effect* handle = amEngine->GetEffectHandle(effect->GetId());
+            if (handle == nullptr)
+                continue;
+
+            created.emplace_back(state.GetId(), CreateEnvironmentBus(handle, length));
+        }
+
+        LockAudioMutex();
+
+        for (auto it = _environmentBuses.begin(); it != _environmentBuses.end();)
+        {
+            if (const Environment environment = amEngine->GetEnvironment(it->first);
+                environment.Valid() && environment.GetEffect() == it->second->effect)
+            {
+                ++it;
+                continue;
+            }
+
+            released.push_back(it->second);
+            it = _environmentBuses.erase(it);
+        }
+
+        for (auto&& [id, bus] : created)
+            _environmentBuses[id] = bus;
+
+        UnlockAudioMutex();
+
+        for (auto* bus : released)
+            DestroyEnvironmentBus(bus);
+    }
+
     AmUInt32 Mixer::Play(
         SoundData* sound, PlayStateFlag flag, AmReal32 gain, AmReal32 pan, AmReal32 pitch, AmReal32 speed, AmUInt32 id, AmUInt32 layer)
     {
@@ -604,6 +753,10 @@ namespace SparkyStudios::Audio::Amplitude
             lay->id = id;
             lay->snd = sound;
 
+            // Let the processors allocate their per-sound state before the audio thread uses it
+            if (_pipeline != nullptr && sound->sound != nullptr)
+                _pipeline->Prepare(sound->sound.get());
+
 #if defined(AM_SIMD_INTRINSICS)
             lay->start = startFrame & ~(kProcessedFramesCount - 1);
             lay->end = endFrame & ~(kProcessedFramesCount - 1);
@@ -822,9 +975,12 @@ namespace SparkyStudios::Audio::Amplitude
         // go through all active layers and set their states to the stop state
         for (auto&& lay : _layers)
         {
-            // check if active and set to stop if true
+            // check if active and stop it like SetPlayState() does, so the sound is cleaned up
             if (AMPLIMIX_LOAD(&lay.flag) > PLAY_STATE_FLAG_STOP)
+            {
+                OnSoundStopped(this, &lay);
                 AMPLIMIX_STORE(&lay.flag, PLAY_STATE_FLAG_STOP);
+            }
         }
 
         UnlockAudioMutex();
@@ -1002,17 +1158,14 @@ namespace SparkyStudios::Audio::Amplitude
 
             if (cursor < layer->snd->chunk->frames && remaining < inSamples)
             {
-                const AmUInt64 size = remaining * layer->snd->format.GetFrameSize();
-
-                std::memcpy(in->buffer, reinterpret_cast<AmAudioSampleBuffer>(layer->snd->chunk->buffer) + offset, size);
+                const AmUInt64 length = remaining * soundChannels;
 
-                std::memcpy(
-                    reinterpret_cast<AmAudioSampleBuffer>(in->buffer) + (remaining * soundChannels), layer->snd->chunk->buffer,
-                    in->size - size);
+                ReadSamples(layer->snd->chunk, offset, length, reinterpret_cast<AmAudioSampleBuffer>(in->buffer));
+                ReadSamples(layer->snd->chunk, 0, in->length - length, reinterpret_cast<AmAudioSampleBuffer>(in->buffer) + length);
             }
             else
             {
-                std::memcpy(in->buffer, reinterpret_cast<AmAudioSampleBuffer>(layer->snd->chunk->buffer) + offset, in->size);
+                ReadSamples(layer->snd->chunk, offset, in->length, reinterpret_cast<AmAudioSampleBuffer>(in->buffer));
             }
         }
 
@@ -1033,10 +1186,14 @@ namespace SparkyStudios::Audio::Amplitude
 
             const auto sampleRate = static_cast<AmUInt32>(std::ceil(layer->snd->format.GetSampleRate() / sampleRateRatio));
 
+            _mixingLayer = layer;
+
             _pipeline->Process(
                 reinterpret_cast<AmAudioSampleBuffer>(out->buffer), reinterpret_cast<AmAudioSampleBuffer>(out->buffer), samples, out->size,
                 reqChannels, sampleRate, layer->snd->sound.get());
 
+            _mixingLayer = nullptr;
+
             /* */ AmReal32 position = cursor;
             const AmUInt64 start = layer->start;
             const AmUInt64 end = layer->end;
@@ -1143,6 +1300,48 @@ namespace SparkyStudios::Audio::Amplitude
         }
     }
 
+    bool Mixer::MixEnvironments(AmAudioSampleBuffer buffer, AmUInt64 frames)
+    {
+        const auto numChannels = static_cast<AmUInt16>(_device.mRequestedOutputChannels);
+        const AmUInt64 length = frames * numChannels;
+        const AmReal32 gain = AMPLIMIX_LOAD(&_masterGain);
+
+        bool mixed = false;
+        for (auto&& [id, bus] : _environmentBuses)
+        {
+            // Nothing has been sent since the tail of the effect has decayed.
+            if (bus->silent || length > bus->buffer.GetSize())
+                continue;
+
+            // Without sends, feed silence to the effect until its tail has decayed.
+            if (!bus->active)
+                std::memset(bus->buffer.GetBuffer(), 0, length * sizeof(AmReal32));
+
+            AmReal32Buffer send = bus->buffer.GetBuffer();
+
+            // Sends are already scaled by the environment factors, the effect parameters are published by Effect::Update().
+            bus->instance->GetFilter()->Process(send, frames, length, numChannels, _device.mRequestedOutputSampleRate);
+
+            AmReal32 peak = 0.0f;
+            for (AmUInt64 i = 0; i < length; ++i)
+            {
+                buffer[i] += send[i] * gain;
+                peak = AM_MAX(peak, std::abs(send[i]));
+            }
+
+            // Delays and pre-delayed reverbs can be quiet for a while before their tail comes back.
+            if (bus->active || peak >= kEnvironmentBusSilenceThreshold)
+                bus->silentFrames = 0;
+            else if ((bus->silentFrames += frames) >= _environmentTailFrames)
+                bus->silent = true;
+
+            bus->active = false;
+            mixed = true;
+        }
+
+        return mixed;
+    }
+
     MixerLayer* Mixer::GetLayer(AmUInt32 layer)
     {
         // get layer based on the lowest bits of layer id
@@ -1158,7 +1357,25 @@ namespace SparkyStudios::Audio::Amplitude
         PlayStateFlag flag = AMPLIMIX_LOAD(&layer->flag);
 
         // return if flag is not cleared
-        return (flag > PLAY_STATE_FLAG_HALT);
+        if (flag <= PLAY_STATE_FLAG_HALT)
+            return false;
+
+        // wait for the sound data to be decoded in the background
+        if (const SoundInstance* instance = layer->snd->sound.get(); instance != nullptr)
+        {
+            const SoundDataState state = instance->GetSound()->GetSoundDataState();
+            if (state == SoundDataState::Loaded)
+                return true;
+
+            // stop the layer if the sound data will never be available, or if it's now too late to play it
+            const AmUInt64 maxLatency = amEngine->GetState()->sound_data_max_latency;
+            if (state != SoundDataState::Loading || (maxLatency > 0 && Thread::GetTimeMillis() - instance->_loadTime > maxLatency))
+                AMPLIMIX_CSWAP(&layer->flag, &flag, PLAY_STATE_FLAG_STOP);
+
+            return false;
+        }
+
+        return true;
     }
 
     void Mixer::UpdatePitch(MixerLayer* layer)
@@ -18,11 +18,13 @@
 #define SS_AMPLITUDE_AUDIO_MIXER_H
 
 #include <queue>
+#include <unordered_map>
 
 #include <SparkyStudios/Audio/Amplitude/Core/Common.h>
 #include <SparkyStudios/Audio/Amplitude/Core/Device.h>
 #include <SparkyStudios/Audio/Amplitude/Core/Thread.h>
 #include <SparkyStudios/Audio/Amplitude/Mixer/Resampler.h>
+#include <SparkyStudios/Audio/Amplitude/Sound/Effect.h>
 
 #include <Mixer/ProcessorPipeline.h>
 #include <Mixer/SoundData.h>
@@ -89,6 +91,23 @@ namespace SparkyStudios::Audio::Amplitude
         void Reset();
     };
 
+    /**
+     * @brief The send bus of an environment.
+     *
+     * Sounds inside the environment add their contribution to the bus, and the environment's
+     * effect processes the summed signal once per mix. Buses are created and released on the
+     * game thread, the audio thread only fills and processes them.
+     */
+    struct EnvironmentBus
+    {
+        Effect* effect = nullptr; // environment effect, referenced while the bus exists
+        EffectInstance* instance = nullptr; // effect instance processing the bus
+        AmAlignedReal32Buffer buffer; // summed sends, then effect output
+        bool active = false; // whether a sound has been sent to the bus in the current mix
+        bool silent = true; // whether the effect tail has decayed since the last send
+        AmUInt64 silentFrames = 0; // frames of silent output since the last send
+    };
+
     struct MixerCommand
     {
         MixerCommandCallback callback; // command callback
@@ -138,6 +157,32 @@ namespace SparkyStudios::Audio::Amplitude
 
         AmUInt64 Mix(AmVoidPtr mixBuffer, AmUInt64 frameCount);
 
+        /**
+         * @brief Adds samples to the send bus of an environment.
+         *
+         * This is meant to be called by sound processors, while the mixer processes a layer. The
+         * samples are scaled by the given level and by the gain of the layer. The environment's
+         * effect is then processed on the bus at the end of the mix. Samples sent to an environment
+         * which has no bus yet for the given effect are dropped.
+         *
+         * @param environment The ID of the environment.
+         * @param effect The effect of the environment.
+         * @param in The interleaved samples to send, in the output channels count of the mixer.
+         * @param frames The number of frames to send.
+         * @param level The send level.
+         */
+        void SendToEnvironment(
+            AmEnvironmentID environment, const Effect* effect, AmConstAudioSampleBuffer in, AmUInt64 frames, AmReal32 level);
+
+        /**
+         * @brief Creates and releases the send buses of the environments.
+         *
+         * This is meant to be called from the game thread once per frame. A bus is created for each
+         * environment with an effect, and released when the environment is removed or its effect
+         * changes. Effect instances and bus buffers are thus never allocated in the audio thread.
+         */
+        void UpdateEnvironmentBuses();
+
         AmUInt32 Play(
             SoundData* sound, PlayStateFlag flag, AmReal32 gain, AmReal32 pan, AmReal32 pitch, AmReal32 speed, AmUInt32 id, AmUInt32 layer);
 
@@ -188,6 +233,7 @@ namespace SparkyStudios::Audio::Amplitude
     private:
         void ExecuteCommands();
         void MixLayer(MixerLayer* layer, AmAudioFrameBuffer buffer, AmUInt64 bufferSize, AmUInt64 samples);
+        bool MixEnvironments(AmAudioSampleBuffer buffer, AmUInt64 frames);
         MixerLayer* GetLayer(AmUInt32 layer);
         bool ShouldMix(MixerLayer* layer);
         void UpdatePitch(MixerLayer* layer);
@@ -208,6 +254,10 @@ namespace SparkyStudios::Audio::Amplitude
 
         ProcessorPipeline* _pipeline;
 
+        const MixerLayer* _mixingLayer;
+        std::unordered_map<AmEnvironmentID, EnvironmentBus*> _environmentBuses;
+        AmUInt64 _environmentTailFrames;
+
         DeviceDescription _device;
     };
 } // namespace SparkyStudios::Audio::Amplitude
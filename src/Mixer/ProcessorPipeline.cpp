@@ -65,6 +65,12 @@ namespace SparkyStudios::Audio::Amplitude
         }
     }
 
+    void ProcessorPipeline::Prepare(SoundInstance* sound)
+    {
+        for (auto&& p : _processors)
+            p->Prepare(sound);
+    }
+
     void ProcessorPipeline::Cleanup(SoundInstance* sound)
     {
         for (auto&& p : _processors)
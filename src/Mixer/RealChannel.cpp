@@ -44,6 +44,7 @@ namespace SparkyStudios::Audio::Amplitude
         , _playSpeed(1.0f)
         , _mixer(nullptr)
         , _activeSounds()
+        , _pendingLayers()
         , _parentChannelState(parent)
         , _playedSounds()
     {}
@@ -120,6 +121,53 @@ namespace SparkyStudios::Audio::Amplitude
 
         _activeSounds[layer] = sound;
         _activeSounds[layer]->SetChannel(this);
+
+        _loop[layer] = _activeSounds[layer]->GetSound()->IsLoop();
+        _stream[layer] = _activeSounds[layer]->GetSound()->IsStream();
+
+        // Sounds loaded on their first play are opened by the loader threads, the layer starts in Update() once they are ready.
+        if (!_activeSounds[layer]->LoadAsync())
+        {
+            _channelLayersId[layer] = kAmInvalidObjectId;
+            _pendingLayers[layer] = false;
+            return true;
+        }
+
+        return Start(layer, false);
+    }
+
+    bool RealChannel::Update()
+    {
+        bool success = true;
+
+        for (auto it = _pendingLayers.begin(); it != _pendingLayers.end();)
+        {
+            const AmUInt32 layer = it->first;
+            const bool paused = it->second;
+
+            if (!_activeSounds[layer]->GetSound()->IsLoaded())
+            {
+                ++it;
+                continue;
+            }
+
+            it = _pendingLayers.erase(it);
+
+            if (!Start(layer, paused))
+            {
+                // The sound instance has not been handed to the mixer.
+                ampooldelete(MemoryPoolKind::Engine, SoundInstance, _activeSounds[layer]);
+                _activeSounds.erase(layer);
+
+                success = false;
+            }
+        }
+
+        return success;
+    }
+
+    bool RealChannel::Start(AmUInt32 layer, bool paused)
+    {
         _activeSounds[layer]->Load();
 
         if (!_activeSounds[layer]->GetUserData())
@@ -129,10 +177,7 @@ namespace SparkyStudios::Audio::Amplitude
             return false;
         }
 
-        _loop[layer] = _activeSounds[layer]->GetSound()->IsLoop();
-        _stream[layer] = _activeSounds[layer]->GetSound()->IsStream();
-
-        const PlayStateFlag loops = _loop[layer] ? PLAY_STATE_FLAG_LOOP : PLAY_STATE_FLAG_PLAY;
+        const PlayStateFlag loops = paused ? PLAY_STATE_FLAG_HALT : _loop[layer] ? PLAY_STATE_FLAG_LOOP : PLAY_STATE_FLAG_PLAY;
 
         _channelLayersId[layer] = _mixer->Play(
             static_cast<SoundData*>(_activeSounds[layer]->GetUserData()), loops, _gain[layer], _pan, _pitch, _playSpeed, _channelId, 0);
@@ -148,8 +193,30 @@ namespace SparkyStudios::Audio::Amplitude
         return success;
     }
 
+    void RealChannel::CancelPending(AmUInt32 layer)
+    {
+        _pendingLayers.erase(layer);
+        _channelLayersId.erase(layer);
+
+        // The sound instance has not been handed to the mixer yet.
+        ampooldelete(MemoryPoolKind::Engine, SoundInstance, _activeSounds[layer]);
+        _activeSounds.erase(layer);
+    }
+
+    void RealChannel::CancelPending()
+    {
+        while (!_pendingLayers.empty())
+            CancelPending(_pendingLayers.begin()->first);
+    }
+
     void RealChannel::Destroy(AmUInt32 layer)
     {
+        if (_pendingLayers.contains(layer))
+        {
+            CancelPending(layer);
+            return;
+        }
+
         AMPLITUDE_ASSERT(Valid() && _channelLayersId[layer] != kAmInvalidObjectId);
 
         const MixerCommandCallback callback = [&, layer]() -> bool
@@ -191,6 +258,10 @@ namespace SparkyStudios::Audio::Amplitude
     bool RealChannel::Playing(AmUInt32 layer) const
     {
         AMPLITUDE_ASSERT(Valid());
+
+        if (const auto it = _pendingLayers.find(layer); it != _pendingLayers.end())
+            return !it->second;
+
         const AmUInt32 state = _mixer->GetPlayState(_channelId, _channelLayersId.at(layer));
 
         if (const auto* collection = _parentChannelState->GetCollection(); collection == nullptr)
@@ -225,12 +296,21 @@ namespace SparkyStudios::Audio::Amplitude
     bool RealChannel::Paused(AmUInt32 layer) const
     {
         AMPLITUDE_ASSERT(Valid());
+
+        if (const auto it = _pendingLayers.find(layer); it != _pendingLayers.end())
+            return it->second;
+
         return _mixer->GetPlayState(_channelId, _channelLayersId.at(layer)) == PLAY_STATE_FLAG_HALT;
     }
 
     void RealChannel::SetGain(const AmReal32 gain)
     {
         AMPLITUDE_ASSERT(Valid());
+
+        // Pending layers start with the last gain of the channel.
+        for (auto&& layer : _pendingLayers)
+            _gain[layer.first] = gain;
+
         for (auto&& layer : _channelLayersId)
         {
             if (layer.second != 0)
@@ -254,18 +334,49 @@ namespace SparkyStudios::Audio::Amplitude
     void RealChannel::Halt(AmUInt32 layer)
     {
         AMPLITUDE_ASSERT(Valid());
+
+        if (layer == kAmInvalidObjectId)
+        {
+            CancelPending();
+        }
+        else if (_pendingLayers.contains(layer))
+        {
+            CancelPending(layer);
+            return;
+        }
+
         _mixer->SetPlayState(_channelId, _channelLayersId[layer], PLAY_STATE_FLAG_STOP);
     }
 
     void RealChannel::Pause(AmUInt32 layer)
     {
         AMPLITUDE_ASSERT(Valid());
+
+        for (auto&& pending : _pendingLayers)
+        {
+            if (layer == kAmInvalidObjectId || pending.first == layer)
+                pending.second = true;
+        }
+
+        if (_pendingLayers.contains(layer))
+            return;
+
         _mixer->SetPlayState(_channelId, _channelLayersId[layer], PLAY_STATE_FLAG_HALT);
     }
 
     void RealChannel::Resume(AmUInt32 layer)
     {
         AMPLITUDE_ASSERT(Valid());
+
+        for (auto&& pending : _pendingLayers)
+        {
+            if (layer == kAmInvalidObjectId || pending.first == layer)
+                pending.second = false;
+        }
+
+        if (_pendingLayers.contains(layer))
+            return;
+
         _mixer->SetPlayState(_channelId, _channelLayersId[layer], _loop[layer] ? PLAY_STATE_FLAG_LOOP : PLAY_STATE_FLAG_PLAY);
     }
 
@@ -70,6 +70,16 @@ namespace SparkyStudios::Audio::Amplitude
          */
         bool Play(SoundInstance* sound, AmUInt32 layer = kAmInvalidObjectId);
 
+        /**
+         * @brief Starts the layers waiting for their sound to be loaded.
+         *
+         * Sounds which are not loaded when played are opened in the background, and their
+         * layer is started by this method once they are ready.
+         *
+         * @return false if a sound could not be started after being loaded, true otherwise.
+         */
+        bool Update();
+
         /**
          * @brief Halt the real channel so it may be re-used. However this virtual channel may still be considered playing.
          */
@@ -201,6 +211,9 @@ namespace SparkyStudios::Audio::Amplitude
     private:
         void SetGainPan(AmReal32 gain, AmReal32 pan, AmUInt32 layer);
         [[nodiscard]] AmUInt32 FindFreeLayer(AmUInt32 layerIndex = 0) const;
+        bool Start(AmUInt32 layer, bool paused);
+        void CancelPending(AmUInt32 layer);
+        void CancelPending();
 
         AmChannelID _channelId;
         std::map<AmUInt32, AmUInt32> _channelLayersId;
@@ -216,6 +229,9 @@ namespace SparkyStudios::Audio::Amplitude
         Mixer* _mixer;
         std::map<AmUInt32, SoundInstance*> _activeSounds;
 
+        // Layers waiting for their sound to be loaded, and whether they have been paused meanwhile.
+        std::map<AmUInt32, bool> _pendingLayers;
+
         ChannelInternalState* _parentChannelState;
 
         std::vector<AmSoundID> _playedSounds;
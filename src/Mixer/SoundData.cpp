@@ -37,7 +37,7 @@ namespace SparkyStudios::Audio::Amplitude
         return sound;
     }
 
-    SoundChunk* SoundChunk::CreateChunk(AmUInt64 frames, AmUInt16 channels, MemoryPoolKind pool)
+    SoundChunk* SoundChunk::CreateChunk(AmUInt64 frames, AmUInt16 channels, MemoryPoolKind pool, AM_SAMPLE_FORMAT sampleFormat)
     {
 #if defined(AM_SIMD_INTRINSICS)
         const AmUInt64 alignedFrames = AM_VALUE_ALIGN(frames, AmAudioFrame::size);
@@ -50,7 +50,8 @@ namespace SparkyStudios::Audio::Amplitude
 
         chunk->frames = alignedFrames;
         chunk->length = alignedLength;
-        chunk->size = alignedLength * sizeof(AmReal32);
+        chunk->size = alignedLength * (sampleFormat == AM_SAMPLE_FORMAT_INT ? sizeof(AmInt16) : sizeof(AmReal32));
+        chunk->sampleFormat = sampleFormat;
 #if defined(AM_SIMD_INTRINSICS)
         chunk->samplesPerVector = AmAudioFrame::size / channels;
 #endif // AM_SIMD_INTRINSICS
@@ -32,13 +32,21 @@ namespace SparkyStudios::Audio::Amplitude
 
         AmAudioFrameBuffer buffer;
 
+        // The format of the samples stored in the buffer. Chunks with AM_SAMPLE_FORMAT_INT
+        // samples hold 16-bit integers and should be widened before being processed.
+        AM_SAMPLE_FORMAT sampleFormat;
+
 #if defined(AM_SIMD_INTRINSICS)
         AmUInt64 samplesPerVector;
 #endif // AM_SIMD_INTRINSICS
 
         MemoryPoolKind memoryPool;
 
-        static SoundChunk* CreateChunk(AmUInt64 frames, AmUInt16 channels, MemoryPoolKind pool = MemoryPoolKind::SoundData);
+        static SoundChunk* CreateChunk(
+            AmUInt64 frames,
+            AmUInt16 channels,
+            MemoryPoolKind pool = MemoryPoolKind::SoundData,
+            AM_SAMPLE_FORMAT sampleFormat = AM_SAMPLE_FORMAT_FLOAT);
         static void DestroyChunk(SoundChunk* chunk);
 
         ~SoundChunk();
@@ -0,0 +1,171 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <Mixer/SoundDataCache.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    SoundDataCache::SoundDataCache()
+        : _mutex(Thread::CreateMutex())
+        , _budget(0)
+        , _entries()
+        , _index()
+        , _stats()
+    {}
+
+    SoundDataCache::~SoundDataCache()
+    {
+        Clear();
+
+        Thread::DestroyMutex(_mutex);
+        _mutex = nullptr;
+    }
+
+    void SoundDataCache::SetBudget(AmSize budget)
+    {
+        Thread::LockMutex(_mutex);
+
+        _budget = budget;
+        EvictUntil(_budget);
+
+        Thread::UnlockMutex(_mutex);
+    }
+
+    AmSize SoundDataCache::GetBudget() const
+    {
+        return _budget;
+    }
+
+    SoundChunk* SoundDataCache::Acquire(AmSoundID id)
+    {
+        Thread::LockMutex(_mutex);
+
+        const auto it = _index.find(id);
+        if (it == _index.end())
+        {
+            _stats.misses++;
+
+            Thread::UnlockMutex(_mutex);
+            return nullptr;
+        }
+
+        SoundChunk* chunk = it->second->chunk;
+
+        _stats.hits++;
+        _stats.residentSize -= chunk->size;
+
+        if (it->second->pinned)
+            _stats.pinnedSize -= chunk->size;
+
+        _entries.erase(it->second);
+        _index.erase(it);
+
+        Thread::UnlockMutex(_mutex);
+        return chunk;
+    }
+
+    void SoundDataCache::Release(AmSoundID id, SoundChunk* chunk, bool pinned)
+    {
+        if (chunk == nullptr)
+            return;
+
+        Thread::LockMutex(_mutex);
+
+        // Only one chunk per sound can be held by the cache.
+        if (const auto it = _index.find(id); it != _index.end())
+            DestroyEntry(it->second);
+
+        if (!pinned)
+        {
+            if (chunk->size > _budget)
+            {
+                Thread::UnlockMutex(_mutex);
+
+                SoundChunk::DestroyChunk(chunk);
+                return;
+            }
+
+            EvictUntil(_budget - chunk->size);
+        }
+
+        _entries.push_front({ id, chunk, pinned });
+        _index[id] = _entries.begin();
+
+        _stats.residentSize += chunk->size;
+
+        if (pinned)
+            _stats.pinnedSize += chunk->size;
+
+        Thread::UnlockMutex(_mutex);
+    }
+
+    void SoundDataCache::Erase(AmSoundID id)
+    {
+        Thread::LockMutex(_mutex);
+
+        if (const auto it = _index.find(id); it != _index.end())
+            DestroyEntry(it->second);
+
+        Thread::UnlockMutex(_mutex);
+    }
+
+    void SoundDataCache::Clear()
+    {
+        Thread::LockMutex(_mutex);
+
+        while (!_entries.empty())
+            DestroyEntry(_entries.begin());
+
+        Thread::UnlockMutex(_mutex);
+    }
+
+    SoundDataCacheStats SoundDataCache::GetStats() const
+    {
+        Thread::LockMutex(_mutex);
+        const SoundDataCacheStats stats = _stats;
+        Thread::UnlockMutex(_mutex);
+
+        return stats;
+    }
+
+    void SoundDataCache::EvictUntil(AmSize size)
+    {
+        auto it = _entries.end();
+        while (_stats.residentSize - _stats.pinnedSize > size && it != _entries.begin())
+        {
+            --it;
+
+            if (it->pinned)
+                continue;
+
+            DestroyEntry(it++);
+            _stats.evictions++;
+        }
+    }
+
+    void SoundDataCache::DestroyEntry(EntryList::iterator it)
+    {
+        _stats.residentSize -= it->chunk->size;
+
+        if (it->pinned)
+            _stats.pinnedSize -= it->chunk->size;
+
+        SoundChunk::DestroyChunk(it->chunk);
+
+        _index.erase(it->id);
+        _entries.erase(it);
+    }
+} // namespace SparkyStudios::Audio::Amplitude
@@ -0,0 +1,128 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef SS_AMPLITUDE_AUDIO_SOUNDDATACACHE_H
+#define SS_AMPLITUDE_AUDIO_SOUNDDATACACHE_H
+
+#include <list>
+#include <unordered_map>
+
+#include <SparkyStudios/Audio/Amplitude/Core/Common.h>
+#include <SparkyStudios/Audio/Amplitude/Core/Thread.h>
+
+#include <SparkyStudios/Audio/Amplitude/Sound/Sound.h>
+
+#include <Mixer/SoundData.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief Keeps the decoded data of non-streamed sounds resident after they stopped playing.
+     *
+     * A Sound checks out its SoundChunk from the cache when its first instance starts playing, and
+     * gives it back when the last instance is destroyed. Entries held by the cache are unreferenced,
+     * and are evicted in least recently used order when the memory budget is exceeded. Pinned entries
+     * are never evicted.
+     */
+    class SoundDataCache
+    {
+    public:
+        SoundDataCache();
+        ~SoundDataCache();
+
+        /**
+         * @brief Sets the maximum amount of memory in bytes the cache can hold.
+         *
+         * Setting a budget of 0 disables the cache, unreferenced chunks are then destroyed immediately.
+         *
+         * @param budget The memory budget in bytes.
+         */
+        void SetBudget(AmSize budget);
+
+        /**
+         * @brief Gets the maximum amount of memory in bytes the cache can hold.
+         *
+         * @return The memory budget in bytes.
+         */
+        [[nodiscard]] AmSize GetBudget() const;
+
+        /**
+         * @brief Takes the decoded data of the given sound out of the cache.
+         *
+         * The caller becomes the owner of the returned chunk until it is given back with Release().
+         *
+         * @param id The ID of the sound.
+         *
+         * @return The cached SoundChunk, or nullptr if the sound data is not in the cache.
+         */
+        SoundChunk* Acquire(AmSoundID id);
+
+        /**
+         * @brief Gives the decoded data of the given sound back to the cache.
+         *
+         * If the chunk doesn't fit in the memory budget, least recently used entries are evicted. If the
+         * chunk is still too large, it is destroyed.
+         *
+         * @param id The ID of the sound.
+         * @param chunk The decoded data of the sound.
+         * @param pinned Whether the entry should never be evicted.
+         */
+        void Release(AmSoundID id, SoundChunk* chunk, bool pinned = false);
+
+        /**
+         * @brief Destroys the cached data of the given sound, if any.
+         *
+         * @param id The ID of the sound.
+         */
+        void Erase(AmSoundID id);
+
+        /**
+         * @brief Destroys all the cached data.
+         */
+        void Clear();
+
+        /**
+         * @brief Gets the statistics of the cache.
+         *
+         * @return The cache statistics.
+         */
+        [[nodiscard]] SoundDataCacheStats GetStats() const;
+
+    private:
+        struct Entry
+        {
+            AmSoundID id;
+            SoundChunk* chunk;
+            bool pinned;
+        };
+
+        typedef std::list<Entry> EntryList;
+
+        void EvictUntil(AmSize size);
+        void DestroyEntry(EntryList::iterator it);
+
+        AmMutexHandle _mutex;
+        AmSize _budget;
+
+        // Most recently used entries are at the front.
+        EntryList _entries;
+        std::unordered_map<AmSoundID, EntryList::iterator> _index;
+
+        SoundDataCacheStats _stats;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // SS_AMPLITUDE_AUDIO_SOUNDDATACACHE_H
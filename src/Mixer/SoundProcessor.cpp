@@ -12,8 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <bitset>
 #include <cstring>
 #include <map>
+#include <mutex>
 #include <utility>
 
 #include <SparkyStudios/Audio/Amplitude/Core/Log.h>
@@ -46,16 +48,67 @@ namespace SparkyStudios::Audio::Amplitude
         return c;
     }
 
+    static std::bitset<AM_MAX_SOUND_PROCESSOR_STATES>& soundProcessorStateSlots()
+    {
+        static std::bitset<AM_MAX_SOUND_PROCESSOR_STATES> s;
+        return s;
+    }
+
+    static std::mutex& soundProcessorStateSlotsMutex()
+    {
+        static std::mutex m;
+        return m;
+    }
+
+    SoundProcessorInstance::SoundProcessorInstance()
+        : m_stateSlot(AM_MAX_SOUND_PROCESSOR_STATES)
+    {
+        // Processor instances can be created and destroyed from any thread.
+        std::lock_guard lock(soundProcessorStateSlotsMutex());
+        auto& slots = soundProcessorStateSlots();
+
+        for (AmUInt32 i = 0; i < AM_MAX_SOUND_PROCESSOR_STATES; ++i)
+        {
+            if (slots.test(i))
+                continue;
+
+            slots.set(i);
+            m_stateSlot = i;
+            return;
+        }
+
+        CallLogFunc("[WARNING] All the sound processor state slots are used. Increase AM_MAX_SOUND_PROCESSOR_STATES.\n");
+    }
+
+    SoundProcessorInstance::~SoundProcessorInstance()
+    {
+        if (m_stateSlot >= AM_MAX_SOUND_PROCESSOR_STATES)
+            return;
+
+        std::lock_guard lock(soundProcessorStateSlotsMutex());
+        soundProcessorStateSlots().reset(m_stateSlot);
+    }
+
     AmSize SoundProcessorInstance::GetOutputBufferSize(AmUInt64 frames, AmSize bufferSize, AmUInt16 channels, AmUInt32 sampleRate)
     {
         return bufferSize;
     }
 
+    void SoundProcessorInstance::Prepare(SoundInstance* sound)
+    {
+        // Do nothing in base class
+    }
+
     void SoundProcessorInstance::Cleanup(SoundInstance* sound)
     {
         // Do nothing in base class
     }
 
+    AmUInt32 SoundProcessorInstance::GetStateSlot() const
+    {
+        return m_stateSlot;
+    }
+
     SoundProcessor::SoundProcessor(std::string name)
         : m_name(std::move(name))
     {
@@ -208,4 +261,22 @@ namespace SparkyStudios::Audio::Amplitude
         SoundChunk::DestroyChunk(dryOut);
         SoundChunk::DestroyChunk(wetOut);
     }
+
+    void ProcessorMixer::Prepare(SoundInstance* sound)
+    {
+        if (_dryProcessor != nullptr)
+            _dryProcessor->Prepare(sound);
+
+        if (_wetProcessor != nullptr)
+            _wetProcessor->Prepare(sound);
+    }
+
+    void ProcessorMixer::Cleanup(SoundInstance* sound)
+    {
+        if (_dryProcessor != nullptr)
+            _dryProcessor->Cleanup(sound);
+
+        if (_wetProcessor != nullptr)
+            _wetProcessor->Cleanup(sound);
+    }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -41,7 +41,8 @@ namespace SparkyStudios::Audio::Amplitude
             if (effect == nullptr)
                 return;
 
-            effect->GetFilter()->Process(out, frames, bufferSize, channels, sampleRate);
+            FilterInstance* filter = effect->GetFilter();
+            filter->Process(out, frames, bufferSize, channels, sampleRate);
         }
     };
 
@@ -20,14 +20,19 @@
 #include <SparkyStudios/Audio/Amplitude/Amplitude.h>
 
 #include <Core/ChannelInternalState.h>
+#include <Core/EngineInternalState.h>
 #include <Mixer/RealChannel.h>
 
 #include "sound_definition_generated.h"
 
 namespace SparkyStudios::Audio::Amplitude
 {
-    static std::map<AmEnvironmentID, std::map<AmObjectID, EffectInstance*>> gEnvironmentFilters = {};
-
+    /**
+     * @brief Sends spatialized sounds to the buses of the environments they are in.
+     *
+     * The sound itself passes through unchanged. Each environment runs its effect once per mix
+     * on the sum of its sends, and the mixer adds the result to the output.
+     */
     class EnvironmentProcessorInstance final : public SoundProcessorInstance
     {
     public:
@@ -46,16 +51,9 @@ namespace SparkyStudios::Audio::Amplitude
                 const Entity& entity = sound->GetChannel()->GetParentChannelState()->GetEntity();
                 if (entity.Valid())
                 {
-                    auto environments = entity.GetEnvironments();
-                    std::vector<std::pair<AmEnvironmentID, AmReal32>> items(environments.begin(), environments.end());
-                    std::ranges::sort(
-                        items,
-                        [](const std::pair<AmEnvironmentID, AmReal32>& a, const std::pair<AmEnvironmentID, AmReal32>& b) -> bool
-                        {
-                            return a.second > b.second;
-                        });
+                    Mixer& mixer = amEngine->GetState()->mixer;
 
-                    for (auto&& environment : items)
+                    for (const auto environments = entity.GetEnvironments(); auto&& environment : environments)
                     {
                         if (environment.second == 0.0f)
                             continue;
@@ -64,30 +62,7 @@ namespace SparkyStudios::Audio::Amplitude
                         if (!handle.Valid())
                             continue;
 
-                        const Effect* effect = handle.GetEffect();
-                        if (!gEnvironmentFilters.contains(environment.first))
-                        {
-                            const std::map<AmSoundID, EffectInstance*> map{};
-                            gEnvironmentFilters[environment.first] = map;
-                        }
-
-                        if (!gEnvironmentFilters[environment.first].contains(sound->GetId()))
-                        {
-                            gEnvironmentFilters[environment.first][sound->GetId()] = effect->CreateInstance();
-                        }
-
-                        SoundChunk* scratch = SoundChunk::CreateChunk(frames, channels, MemoryPoolKind::Amplimix);
-                        std::memcpy(reinterpret_cast<AmAudioSampleBuffer>(scratch->buffer), in, bufferSize);
-
-                        FilterInstance* filterInstance = gEnvironmentFilters[environment.first][sound->GetId()]->GetFilter();
-                        filterInstance->SetFilterParameter(0, environment.second);
-                        filterInstance->Process(
-                            reinterpret_cast<AmAudioSampleBuffer>(scratch->buffer), frames, bufferSize, channels, sampleRate);
-
-                        std::memcpy(out, reinterpret_cast<AmAudioSampleBuffer>(scratch->buffer), bufferSize);
-                        SoundChunk::DestroyChunk(scratch);
-
-                        return;
+                        mixer.SendToEnvironment(environment.first, handle.GetEffect(), in, frames, environment.second);
                     }
                 }
             }
@@ -95,31 +70,6 @@ namespace SparkyStudios::Audio::Amplitude
             if (out != in)
                 std::memcpy(out, in, bufferSize);
         }
-
-        void Cleanup(SoundInstance* sound) override
-        {
-            const Entity& entity = sound->GetChannel()->GetParentChannelState()->GetEntity();
-            if (!entity.Valid())
-                return;
-
-            for (const auto environments = entity.GetEnvironments(); auto&& environment : environments)
-            {
-                if (!gEnvironmentFilters.contains(environment.first))
-                    continue;
-
-                if (!gEnvironmentFilters[environment.first].contains(sound->GetId()))
-                    continue;
-
-                const Environment& handle = amEngine->GetEnvironment(environment.first);
-                if (!handle.Valid())
-                    continue;
-
-                const Effect* effect = handle.GetEffect();
-                effect->DestroyInstance(gEnvironmentFilters[environment.first][sound->GetId()]);
-
-                gEnvironmentFilters[environment.first].erase(sound->GetId());
-            }
-        }
     };
 
     class EnvironmentProcessor final : public SoundProcessor
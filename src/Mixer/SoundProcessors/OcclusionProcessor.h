@@ -24,8 +24,6 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
-    static std::map<AmObjectID, FilterInstance*> gOcclusionFilters = {};
-
     class OcclusionProcessorInstance : public SoundProcessorInstance
     {
     public:
@@ -34,6 +32,17 @@ namespace SparkyStudios::Audio::Amplitude
             , _lpFilter()
         {
             _lpfCurve.SetFader("Exponential");
+
+            // The cutoff frequency is updated from the occlusion amount before each processing.
+            _lpFilter.InitLowPass(1000.0f, 0.5f);
+        }
+
+        void Prepare(SoundInstance* sound) override
+        {
+            if (sound->GetProcessorState(m_stateSlot) != nullptr)
+                return;
+
+            sound->SetProcessorState(m_stateSlot, _lpFilter.CreateInstance());
         }
 
         void Process(
@@ -62,17 +71,14 @@ namespace SparkyStudios::Audio::Amplitude
 
             if (const AmReal32 lpf = lpfCurve.Get(occlusion); lpf > 0)
             {
-                if (!gOcclusionFilters.contains(sound->GetId()))
+                if (auto* filter = static_cast<FilterInstance*>(sound->GetProcessorState(m_stateSlot)); filter != nullptr)
                 {
-                    _lpFilter.InitLowPass(std::ceil(_lpfCurve.Get(lpf)), 0.5f);
-                    gOcclusionFilters[sound->GetId()] = _lpFilter.CreateInstance();
-                }
+                    // Update the filter coefficients
+                    filter->SetFilterParameter(BiquadResonantFilter::ATTRIBUTE_FREQUENCY, _lpfCurve.Get(lpf));
 
-                // Update the filter coefficients
-                gOcclusionFilters[sound->GetId()]->SetFilterParameter(BiquadResonantFilter::ATTRIBUTE_FREQUENCY, _lpfCurve.Get(lpf));
-
-                // Apply Low Pass Filter
-                gOcclusionFilters[sound->GetId()]->Process(out, frames, bufferSize, channels, sampleRate);
+                    // Apply Low Pass Filter
+                    filter->Process(out, frames, bufferSize, channels, sampleRate);
+                }
             }
 
             const AmReal32 gain = gainCurve.Get(occlusion);
@@ -104,11 +110,12 @@ namespace SparkyStudios::Audio::Amplitude
 
         void Cleanup(SoundInstance* sound) override
         {
-            if (!gOcclusionFilters.contains(sound->GetId()))
+            auto* filter = static_cast<FilterInstance*>(sound->GetProcessorState(m_stateSlot));
+            if (filter == nullptr)
                 return;
 
-            _lpFilter.DestroyInstance(gOcclusionFilters[sound->GetId()]);
-            gOcclusionFilters.erase(sound->GetId());
+            _lpFilter.DestroyInstance(filter);
+            sound->SetProcessorState(m_stateSlot, nullptr);
         }
 
     private:
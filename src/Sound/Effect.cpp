@@ -20,30 +20,35 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
-    static std::unordered_map<AmEffectID, std::vector<EffectInstance*>> gEffectsList = {};
-
     Effect::Effect()
         : _instances()
+        , _instancesMutex(Thread::CreateMutex())
         , _parameters()
         , _filter(nullptr)
     {}
 
     Effect::~Effect()
     {
-        for (auto&& instance : gEffectsList[_id])
-            DestroyInstance(instance);
+        for (auto&& instance : _instances)
+            ampooldelete(MemoryPoolKind::Engine, EffectInstance, instance);
+
+        _instances.clear();
+
+        Thread::DestroyMutex(_instancesMutex);
+        _instancesMutex = nullptr;
 
         _filter = nullptr;
         _parameters.clear();
-
-        gEffectsList.erase(_id);
     }
 
     EffectInstance* Effect::CreateInstance() const
     {
         auto* effect = ampoolnew(MemoryPoolKind::Engine, EffectInstance, this);
-        auto& list = gEffectsList[_id];
-        list.push_back(effect);
+
+        Thread::LockMutex(_instancesMutex);
+        _instances.push_back(effect);
+        Thread::UnlockMutex(_instancesMutex);
+
         return effect;
     }
 
@@ -52,22 +57,28 @@ namespace SparkyStudios::Audio::Amplitude
         if (instance == nullptr)
             return;
 
-        auto& list = gEffectsList[_id];
-        list.erase(std::ranges::find(list, instance));
+        Thread::LockMutex(_instancesMutex);
+        if (const auto it = std::ranges::find(_instances, instance); it != _instances.end())
+            _instances.erase(it);
+        Thread::UnlockMutex(_instancesMutex);
 
         ampooldelete(MemoryPoolKind::Engine, EffectInstance, instance);
     }
 
     void Effect::Update()
     {
-        // Update effect parameters
-        for (auto&& instance : gEffectsList[_id])
+        Thread::LockMutex(_instancesMutex);
+
+        // Publish effect parameters, the instances discard the values which did not change
+        for (auto&& instance : _instances)
         {
             for (AmSize i = 0, l = _parameters.size(); i < l; ++i)
             {
                 instance->GetFilter()->SetFilterParameter(i, _parameters[i].GetValue());
             }
         }
+
+        Thread::UnlockMutex(_instancesMutex);
     }
 
     bool Effect::LoadDefinition(const EffectDefinition* definition, EngineInternalState* state)
@@ -90,8 +101,6 @@ namespace SparkyStudios::Audio::Amplitude
         for (flatbuffers::uoffset_t i = 0; i < paramCount; ++i)
             _parameters[i].Init(definition->parameters()->Get(i));
 
-        gEffectsList[_id] = {};
-
         return true;
     }
 
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <limits>
+
 #include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
 #include <SparkyStudios/Audio/Amplitude/Sound/Filter.h>
 
@@ -132,25 +134,36 @@ namespace SparkyStudios::Audio::Amplitude
         , m_numParams(0)
         , m_numParamsChanged(0)
         , m_parameters(nullptr)
+        , _pendingParameters(nullptr)
+        , _pendingParamsChanged(0)
+        , _rampParameters(nullptr)
+        , _rampingParams(0)
     {}
 
     FilterInstance::~FilterInstance()
     {
-        ampoolfree(MemoryPoolKind::Filtering, m_parameters);
+        FreeParameters();
     }
 
     AmResult FilterInstance::Init(AmUInt32 numParams)
     {
-        ampoolfree(MemoryPoolKind::Filtering, m_parameters);
+        FreeParameters();
 
         m_numParams = numParams;
         m_parameters = static_cast<AmReal32Buffer>(ampoolmalloc(MemoryPoolKind::Filtering, numParams * sizeof(AmReal32)));
+        _rampParameters = static_cast<AmReal32Buffer>(ampoolmalloc(MemoryPoolKind::Filtering, numParams * sizeof(AmReal32)));
+        _pendingParameters = static_cast<std::atomic<AmReal32>*>(
+            ampoolmalloc(MemoryPoolKind::Filtering, numParams * sizeof(std::atomic<AmReal32>)));
 
-        if (m_parameters == nullptr)
+        if (m_parameters == nullptr || _rampParameters == nullptr || _pendingParameters == nullptr)
         {
             ampoolfree(MemoryPoolKind::Filtering, m_parameters);
+            ampoolfree(MemoryPoolKind::Filtering, _rampParameters);
+            ampoolfree(MemoryPoolKind::Filtering, _pendingParameters);
 
             m_parameters = nullptr;
+            _rampParameters = nullptr;
+            _pendingParameters = nullptr;
             m_numParams = 0;
 
             return AM_ERROR_OUT_OF_MEMORY;
@@ -160,6 +173,14 @@ namespace SparkyStudios::Audio::Amplitude
 
         m_parameters[0] = 1; // Set 'Wet' to 1
 
+        // Filters set their defaults directly in m_parameters, so nothing has been published yet.
+        // NaN never compares equal, which makes the first SetFilterParameter() of each parameter always publish it.
+        for (AmUInt32 i = 0; i < m_numParams; ++i)
+            new (&_pendingParameters[i]) std::atomic<AmReal32>(std::numeric_limits<AmReal32>::quiet_NaN());
+
+        _pendingParamsChanged.store(0, std::memory_order_relaxed);
+        _rampingParams = 0;
+
         return 0;
     }
 
@@ -171,6 +192,8 @@ namespace SparkyStudios::Audio::Amplitude
         if (buffer == nullptr)
             return;
 
+        UpdateParameters();
+
         for (AmUInt16 c = 0; c < channels; c++)
             ProcessChannel(buffer, c, frames, channels, sampleRate);
     }
@@ -203,10 +226,56 @@ namespace SparkyStudios::Audio::Amplitude
         if (attributeId >= m_numParams)
             return;
 
-        if (m_parameters[attributeId] == value)
+        // Only the publishing thread writes the pending values, a relaxed load is enough to detect changes.
+        if (_pendingParameters[attributeId].load(std::memory_order_relaxed) == value)
+            return;
+
+        _pendingParameters[attributeId].store(value, std::memory_order_relaxed);
+        _pendingParamsChanged.fetch_or(1 << attributeId, std::memory_order_release);
+    }
+
+    void FilterInstance::UpdateParameters()
+    {
+        // Most of the time, no parameter changed since the previous block nor during it.
+        if (_rampingParams == 0 && _pendingParamsChanged.load(std::memory_order_relaxed) == 0)
             return;
 
-        m_parameters[attributeId] = value;
-        m_numParamsChanged |= 1 << attributeId;
+        const AmUInt32 changed = _pendingParamsChanged.exchange(0, std::memory_order_acquire);
+
+        for (AmUInt32 i = 0; i < m_numParams; ++i)
+        {
+            if ((changed & (1 << i)) == 0)
+                continue;
+
+            _rampParameters[i] = m_parameters[i];
+            m_parameters[i] = _pendingParameters[i].load(std::memory_order_relaxed);
+        }
+
+        // The previous ramps reached their target at the end of the previous block.
+        _rampingParams = changed;
+        m_numParamsChanged |= changed;
+    }
+
+    AmReal32 FilterInstance::GetParameterRamp(AmUInt32 attributeId, AmUInt64 frames, AmReal32& step) const
+    {
+        if ((_rampingParams & (1 << attributeId)) == 0 || frames == 0)
+        {
+            step = 0.0f;
+            return m_parameters[attributeId];
+        }
+
+        step = (m_parameters[attributeId] - _rampParameters[attributeId]) / static_cast<AmReal32>(frames);
+        return _rampParameters[attributeId];
+    }
+
+    void FilterInstance::FreeParameters()
+    {
+        ampoolfree(MemoryPoolKind::Filtering, m_parameters);
+        ampoolfree(MemoryPoolKind::Filtering, _rampParameters);
+        ampoolfree(MemoryPoolKind::Filtering, _pendingParameters);
+
+        m_parameters = nullptr;
+        _rampParameters = nullptr;
+        _pendingParameters = nullptr;
     }
 } // namespace SparkyStudios::Audio::Amplitude
\ No newline at end of file
@@ -18,8 +18,14 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    // The cutoff frequency of the low shelf boosting the bass.
+    constexpr AmReal32 kBassBoostFrequency = 250.0f;
+
+    // The lowest boost the shelf can apply, about -60 dB.
+    constexpr AmReal32 kBassBoostMinimum = 0.001f;
+
     BassBoostFilter::BassBoostFilter()
-        : FFTFilter("BassBoost")
+        : Filter("BassBoost")
         , m_boost(2.0f)
     {}
 
@@ -74,22 +80,43 @@ namespace SparkyStudios::Audio::Amplitude
     }
 
     BassBoostFilterInstance::BassBoostFilterInstance(BassBoostFilter* parent)
-        : FFTFilterInstance(parent)
+        : FilterInstance(parent)
+        , _cascade()
+        , _sampleRate(0)
     {
         Init(BassBoostFilter::ATTRIBUTE_LAST);
+        _cascade.Initialize(AM_MAX_CHANNELS, 1);
         m_parameters[BassBoostFilter::ATTRIBUTE_BOOST] = parent->m_boost;
     }
 
-    void BassBoostFilterInstance::ProcessFFTChannel(
-        SplitComplex& fft, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate)
+    void BassBoostFilterInstance::Process(
+        AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate)
     {
-        frames = 2;
+        UpdateParameters();
+
+        if (buffer == nullptr)
+            return;
+
+        const bool reset = _cascade.GetLaneCount() != channels;
+        if (reset)
+            _cascade.SetLaneCount(channels);
+
+        if (reset || m_numParamsChanged != 0 || sampleRate != _sampleRate)
+        {
+            _sampleRate = sampleRate;
+
+            // The boost is a linear gain applied to the frequencies below the shelf.
+            const AmReal32 boost = AM_MAX(m_parameters[BassBoostFilter::ATTRIBUTE_BOOST], kBassBoostMinimum);
+            const BiquadCoefficients coefficients =
+                BiquadCoefficients::LowShelf(kBassBoostFrequency, 1.0f, 20.0f * std::log10(boost), sampleRate)
+                    .WithWet(m_parameters[BassBoostFilter::ATTRIBUTE_WET]);
 
-        Comp2MagPhase(fft, frames);
+            for (AmUInt16 c = 0; c < channels; c++)
+                _cascade.SetCoefficients(0, c, coefficients, !reset);
+        }
 
-        for (AmUInt32 i = 0; i < frames; i++)
-            fft.re()[i] *= m_parameters[BassBoostFilter::ATTRIBUTE_BOOST];
+        m_numParamsChanged = 0;
 
-        MagPhase2Comp(fft, frames);
+        _cascade.ProcessInterleaved(buffer, frames);
     }
 } // namespace SparkyStudios::Audio::Amplitude
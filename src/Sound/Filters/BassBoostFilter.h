@@ -17,22 +17,29 @@
 #ifndef SS_AMPLITUDE_AUDIO_BASS_BOOST_FILTER_H
 #define SS_AMPLITUDE_AUDIO_BASS_BOOST_FILTER_H
 
-#include <Sound/Filters/FFTFilter.h>
+#include <SparkyStudios/Audio/Amplitude/Sound/Filter.h>
+
+#include <Utils/Audio/Filters/BiquadCascade.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
     class BassBoostFilter;
 
-    class BassBoostFilterInstance : public FFTFilterInstance
+    class BassBoostFilterInstance : public FilterInstance
     {
     public:
         explicit BassBoostFilterInstance(BassBoostFilter* parent);
         ~BassBoostFilterInstance() override = default;
 
-        void ProcessFFTChannel(SplitComplex& fft, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate) override;
+        void Process(
+            AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate) override;
+
+    private:
+        BiquadCascade _cascade;
+        AmUInt32 _sampleRate;
     };
 
-    [[maybe_unused]] static class BassBoostFilter final : public FFTFilter
+    [[maybe_unused]] static class BassBoostFilter final : public Filter
     {
         friend class BassBoostFilterInstance;
 
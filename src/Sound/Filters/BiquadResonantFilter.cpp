@@ -150,152 +150,70 @@ namespace SparkyStudios::Audio::Amplitude
 
     BiquadResonantFilterInstance::BiquadResonantFilterInstance(BiquadResonantFilter* parent)
         : FilterInstance(parent)
-        , _state{}
-        , _a0(0)
-        , _a1(0)
-        , _a2(0)
-        , _b1(0)
-        , _b2(0)
+        , _cascade()
+        , _sampleRate(0)
     {
-        for (auto&& i : _state)
-        {
-            i.x1 = 0;
-            i.y1 = 0;
-            i.x2 = 0;
-            i.y2 = 0;
-        }
-
         Init(BiquadResonantFilter::ATTRIBUTE_LAST);
+        _cascade.Initialize(AM_MAX_CHANNELS, 1);
 
         m_parameters[BiquadResonantFilter::ATTRIBUTE_GAIN] = parent->_gain;
         m_parameters[BiquadResonantFilter::ATTRIBUTE_RESONANCE] = parent->_resonance;
         m_parameters[BiquadResonantFilter::ATTRIBUTE_FREQUENCY] = parent->_frequency;
         m_parameters[BiquadResonantFilter::ATTRIBUTE_TYPE] = static_cast<AmReal32>(parent->_filterType);
-
-        _sampleRate = 44100;
-
-        ComputeBiquadResonantParams();
     }
 
-    void BiquadResonantFilterInstance::ProcessChannel(
-        AmAudioSampleBuffer buffer, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate)
+    void BiquadResonantFilterInstance::Process(
+        AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate)
     {
-        if (m_numParamsChanged &
-                (1 << BiquadResonantFilter::ATTRIBUTE_FREQUENCY | 1 << BiquadResonantFilter::ATTRIBUTE_RESONANCE |
-                 1 << BiquadResonantFilter::ATTRIBUTE_GAIN | 1 << BiquadResonantFilter::ATTRIBUTE_TYPE) ||
-            sampleRate != _sampleRate)
-        {
-            _sampleRate = sampleRate;
-            ComputeBiquadResonantParams();
-        }
-
-        m_numParamsChanged = 0;
+        UpdateParameters();
 
-        FilterInstance::ProcessChannel(buffer, channel, frames, channels, sampleRate);
-    }
+        if (buffer == nullptr)
+            return;
 
-    AmAudioSample BiquadResonantFilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
-    {
-        BiquadResonantStateData& state = _state[channel];
+        // The coefficients of a new filter are applied right away, later changes are interpolated over the block.
+        const bool reset = _cascade.GetLaneCount() != channels;
+        if (reset)
+            _cascade.SetLaneCount(channels);
 
-        const AmReal32 x = sample;
-        /* */ AmReal32 y;
-
-        const AmReal32 x1 = state.x1;
-        const AmReal32 x2 = state.x2;
-        const AmReal32 y1 = state.y1;
-        const AmReal32 y2 = state.y2;
+        if (reset || m_numParamsChanged != 0 || sampleRate != _sampleRate)
+        {
+            _sampleRate = sampleRate;
 
-        y = _a0 * x + _a1 * x1 + _a2 * x2 - _b1 * y1 - _b2 * y2;
+            const BiquadCoefficients coefficients =
+                ComputeBiquadResonantParams().WithWet(m_parameters[BiquadResonantFilter::ATTRIBUTE_WET]);
 
-        state.x1 = x;
-        state.x2 = x1;
-        state.y1 = y;
-        state.y2 = y1;
+            for (AmUInt16 c = 0; c < channels; c++)
+                _cascade.SetCoefficients(0, c, coefficients, !reset);
+        }
 
-        y = x + (y - x) * m_parameters[BiquadResonantFilter::ATTRIBUTE_WET];
+        m_numParamsChanged = 0;
 
-        return static_cast<AmAudioSample>(y);
+        _cascade.ProcessInterleaved(buffer, frames);
     }
 
-    void BiquadResonantFilterInstance::ComputeBiquadResonantParams()
+    BiquadCoefficients BiquadResonantFilterInstance::ComputeBiquadResonantParams() const
     {
+        const AmReal32 frequency = m_parameters[BiquadResonantFilter::ATTRIBUTE_FREQUENCY];
         const AmReal32 q = m_parameters[BiquadResonantFilter::ATTRIBUTE_RESONANCE];
-        const AmReal32 omega = 2.0f * M_PI * m_parameters[BiquadResonantFilter::ATTRIBUTE_FREQUENCY] / static_cast<AmReal32>(_sampleRate);
-        const AmReal32 sinOmega = std::sin(omega);
-        const AmReal32 cosOmega = std::cos(omega);
-        const AmReal32 A = std::pow(10.0f, (m_parameters[BiquadResonantFilter::ATTRIBUTE_GAIN] / 40.0f));
-
-        AmReal32 scalar, alpha, beta;
+        const AmReal32 gain = m_parameters[BiquadResonantFilter::ATTRIBUTE_GAIN];
 
         switch (static_cast<AmUInt32>(m_parameters[BiquadResonantFilter::ATTRIBUTE_TYPE]))
         {
         default:
         case BiquadResonantFilter::TYPE_LOW_PASS:
-            alpha = sinOmega / (2.0f * q);
-            scalar = 1.0f / (1.0f + alpha);
-            _a0 = 0.5f * (1.0f - cosOmega) * scalar;
-            _a1 = (1.0f - cosOmega) * scalar;
-            _a2 = _a0;
-            _b1 = -2.0f * cosOmega * scalar;
-            _b2 = (1.0f - alpha) * scalar;
-            break;
+            return BiquadCoefficients::LowPass(frequency, q, _sampleRate);
         case BiquadResonantFilter::TYPE_HIGH_PASS:
-            alpha = sinOmega / (2.0f * q);
-            scalar = 1.0f / (1.0f + alpha);
-            _a0 = 0.5f * (1.0f + cosOmega) * scalar;
-            _a1 = -(1.0f + cosOmega) * scalar;
-            _a2 = _a0;
-            _b1 = -2.0f * cosOmega * scalar;
-            _b2 = (1.0f - alpha) * scalar;
-            break;
+            return BiquadCoefficients::HighPass(frequency, q, _sampleRate);
         case BiquadResonantFilter::TYPE_BAND_PASS:
-            alpha = sinOmega / (2.0f * q);
-            scalar = 1.0f / (1.0f + alpha);
-            _a0 = q * alpha * scalar;
-            _a1 = 0.0f;
-            _a2 = -_a0;
-            _b1 = -2.0f * cosOmega * scalar;
-            _b2 = (1.0f - alpha) * scalar;
-            break;
+            return BiquadCoefficients::BandPass(frequency, q, _sampleRate);
         case BiquadResonantFilter::TYPE_PEAK:
-            alpha = sinOmega / (2.0f * q);
-            scalar = 1.0f / (1.0f + (alpha / A));
-            _a0 = (1.0f + (alpha * A)) * scalar;
-            _a1 = -2.0f * cosOmega * scalar;
-            _a2 = (1.0f - (alpha * A)) * scalar;
-            _b1 = -2.0f * cosOmega * scalar;
-            _b2 = (1.0f - (alpha / A)) * scalar;
-            break;
+            return BiquadCoefficients::Peak(frequency, q, gain, _sampleRate);
         case BiquadResonantFilter::TYPE_NOTCH:
-            alpha = sinOmega / (2.0f * q);
-            scalar = 1.0f / (1.0f + alpha);
-            _a0 = 1.0f * scalar;
-            _a1 = -2.0f * cosOmega * scalar;
-            _a2 = _a0;
-            _b1 = -2.0f * cosOmega * scalar;
-            _b2 = (1.0f - alpha) * scalar;
-            break;
+            return BiquadCoefficients::Notch(frequency, q, _sampleRate);
         case BiquadResonantFilter::TYPE_LOW_SHELF:
-            alpha = sinOmega / (2.0f * std::sqrt((A + 1.0f / A) * (1.0f / q - 1.0f) + 2.0f));
-            beta = 2.0f * std::sqrt(A) * alpha;
-            scalar = 1.0f / ((A + 1.0f) + (A - 1.0f) * cosOmega + beta);
-            _a0 = (A * ((A + 1.0f) - (A - 1.0f) * cosOmega + beta)) * scalar;
-            _a1 = (2.0f * A * ((A - 1.0f) - (A + 1.0f) * cosOmega)) * scalar;
-            _a2 = (A * ((A + 1.0f) - (A - 1.0f) * cosOmega - beta)) * scalar;
-            _b1 = (-2.0f * ((A - 1.0f) + (A + 1.0f) * cosOmega)) * scalar;
-            _b2 = ((A + 1.0f) + (A - 1.0f) * cosOmega - beta) * scalar;
-            break;
+            return BiquadCoefficients::LowShelf(frequency, q, gain, _sampleRate);
         case BiquadResonantFilter::TYPE_HIGH_SHELF:
-            alpha = sinOmega / (2.0f * std::sqrt((A + 1.0f / A) * (1.0f / q - 1.0f) + 2.0f));
-            beta = 2.0f * std::sqrt(A) * alpha;
-            scalar = 1.0f / ((A + 1.0f) - (A - 1.0f) * cosOmega + beta);
-            _a0 = (A * ((A + 1.0f) + (A - 1.0f) * cosOmega + beta)) * scalar;
-            _a1 = (-2.0f * A * ((A - 1.0f) + (A + 1.0f) * cosOmega)) * scalar;
-            _a2 = (A * ((A + 1.0f) + (A - 1.0f) * cosOmega - beta)) * scalar;
-            _b1 = (2.0f * ((A - 1.0f) - (A + 1.0f) * cosOmega)) * scalar;
-            _b2 = ((A + 1.0f) - (A - 1.0f) * cosOmega - beta) * scalar;
-            break;
+            return BiquadCoefficients::HighShelf(frequency, q, gain, _sampleRate);
         }
     }
-} // namespace SparkyStudios::Audio::Amplitude
\ No newline at end of file
+} // namespace SparkyStudios::Audio::Amplitude
@@ -19,31 +19,25 @@
 
 #include <SparkyStudios/Audio/Amplitude/Sound/Filter.h>
 
+#include <Utils/Audio/Filters/BiquadCascade.h>
+
 namespace SparkyStudios::Audio::Amplitude
 {
     class BiquadResonantFilter;
 
-    struct BiquadResonantStateData
-    {
-        AmReal32 y1, y2, x1, x2;
-    };
-
     class BiquadResonantFilterInstance : public FilterInstance
     {
     public:
         explicit BiquadResonantFilterInstance(BiquadResonantFilter* parent);
         ~BiquadResonantFilterInstance() override = default;
 
-        void ProcessChannel(AmAudioSampleBuffer buffer, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate)
-            override;
-
-        AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) override;
+        void Process(
+            AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate) override;
 
     private:
-        void ComputeBiquadResonantParams();
+        [[nodiscard]] BiquadCoefficients ComputeBiquadResonantParams() const;
 
-        BiquadResonantStateData _state[AM_MAX_CHANNELS];
-        AmReal32 _a0, _a1, _a2, _b1, _b2;
+        BiquadCascade _cascade;
         AmUInt32 _sampleRate;
     };
 
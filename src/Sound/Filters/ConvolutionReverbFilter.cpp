@@ -0,0 +1,516 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include <Core/EngineInternalState.h>
+#include <Sound/Filters/ConvolutionReverbFilter.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    using Convolution::TwoStageConvolver;
+
+    // The head is convolved on the audio thread, so its blocks are kept short.
+    constexpr AmSize kHeadBlockSize = 256;
+
+    // The tail is convolved on the workers, once every kTailBlockSize frames.
+    constexpr AmSize kTailBlockSize = 4096;
+
+    constexpr AmUInt32 kWorkerCount = 2;
+
+    /**
+     * @brief Runs the tail convolution of a BackgroundConvolver on a thread pool.
+     */
+    class BackgroundConvolverTask final : public Thread::PoolTask
+    {
+    public:
+        explicit BackgroundConvolverTask(BackgroundConvolver* convolver)
+            : _convolver(convolver)
+            , _scheduled(false)
+            , _running(false)
+        {}
+
+        void Work() override
+        {
+            {
+                std::lock_guard lock(_mutex);
+                _running = true;
+            }
+
+            // Tail blocks queued after the last processing reschedule the task, unless it's still running.
+            do
+            {
+                _convolver->DoBackgroundProcessing();
+                _scheduled.store(false, std::memory_order_seq_cst);
+            } while (_convolver->HasBackgroundProcessing() && !_scheduled.exchange(true, std::memory_order_seq_cst));
+
+            std::lock_guard lock(_mutex);
+            _running = false;
+            _condition.notify_all();
+        }
+
+        /**
+         * @brief Marks the task as scheduled, without blocking.
+         *
+         * @return Whether the task must be added to the pool, @c false if it's already scheduled.
+         */
+        bool Schedule()
+        {
+            return !_scheduled.exchange(true, std::memory_order_seq_cst);
+        }
+
+        void Wait()
+        {
+            std::unique_lock lock(_mutex);
+            _condition.wait(
+                lock,
+                [this]
+                {
+                    return !_running && !_scheduled.load(std::memory_order_seq_cst);
+                });
+        }
+
+    private:
+        BackgroundConvolver* _convolver;
+
+        std::atomic<bool> _scheduled;
+
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        bool _running;
+    };
+
+    /**
+     * @brief Loads the impulse response of a ConvolutionReverbFilter on the sound data loader threads.
+     */
+    class LoadImpulseResponseTask final : public Thread::PoolTask
+    {
+    public:
+        explicit LoadImpulseResponseTask(ConvolutionReverbFilter* filter)
+            : PoolTask()
+            , _filter(filter)
+        {}
+
+        void Work() override
+        {
+            _filter->LoadImpulseResponse();
+        }
+
+        bool Ready() override
+        {
+            return _filter != nullptr;
+        }
+
+    private:
+        ConvolutionReverbFilter* _filter = nullptr;
+    };
+
+    BackgroundConvolver::BackgroundConvolver(Thread::Pool* workers)
+        : TwoStageConvolver()
+        , _workers(workers)
+        , _task(std::make_shared<BackgroundConvolverTask>(this))
+    {}
+
+    BackgroundConvolver::~BackgroundConvolver()
+    {
+        // The task uses the buffers of the convolver.
+        _task->Wait();
+    }
+
+    void BackgroundConvolver::StartBackgroundProcessing()
+    {
+        if (_task->Schedule())
+            _workers->AddTask(_task);
+    }
+
+    ConvolutionReverbFilter::ConvolutionReverbFilter(std::string name, AmOsString path)
+        : Filter(std::move(name))
+        , _path(std::move(path))
+        , _prototypes()
+        , _channels(0)
+        , _mutex()
+        , _condition()
+        , _loaded(false)
+        , _loading(false)
+        , _instancesCount(0)
+        , _pendingInstances()
+        , _workers(nullptr)
+    {}
+
+    ConvolutionReverbFilter::~ConvolutionReverbFilter()
+    {
+        if (MemoryManager::IsInitialized())
+            Unload();
+    }
+
+    AmResult ConvolutionReverbFilter::Load()
+    {
+        {
+            std::unique_lock lock(_mutex);
+            _condition.wait(
+                lock,
+                [this]
+                {
+                    return !_loading;
+                });
+
+            if (_loaded)
+                return AM_ERROR_NO_ERROR;
+
+            _loading = true;
+        }
+
+        return LoadImpulseResponse();
+    }
+
+    AmResult ConvolutionReverbFilter::Unload()
+    {
+        std::unique_lock lock(_mutex);
+
+        // The loader task uses the filter.
+        _condition.wait(
+            lock,
+            [this]
+            {
+                return !_loading;
+            });
+
+        if (_instancesCount > 0)
+        {
+            CallLogFunc(
+                "[ERROR] Cannot unload the convolution reverb '%s': %u instances are still alive.\n", m_name.c_str(), _instancesCount);
+
+            return AM_ERROR_UNKNOWN;
+        }
+
+        _workers.reset(nullptr);
+
+        DestroyPrototypes();
+
+        _loaded = false;
+
+        return AM_ERROR_NO_ERROR;
+    }
+
+    const AmOsString& ConvolutionReverbFilter::GetPath() const
+    {
+        return _path;
+    }
+
+    AmUInt32 ConvolutionReverbFilter::GetParamCount() const
+    {
+        return ATTRIBUTE_LAST;
+    }
+
+    AmString ConvolutionReverbFilter::GetParamName(AmUInt32 index) const
+    {
+        switch (index)
+        {
+        case ATTRIBUTE_WET:
+            return "Wet";
+        case ATTRIBUTE_DRY:
+            return "Dry";
+        default:
+            return "";
+        }
+    }
+
+    AmUInt32 ConvolutionReverbFilter::GetParamType(AmUInt32 index) const
+    {
+        return PARAM_FLOAT;
+    }
+
+    AmReal32 ConvolutionReverbFilter::GetParamMax(AmUInt32 index) const
+    {
+        return 1.0f;
+    }
+
+    AmReal32 ConvolutionReverbFilter::GetParamMin(AmUInt32 index) const
+    {
+        return 0.0f;
+    }
+
+    FilterInstance* ConvolutionReverbFilter::CreateInstance()
+    {
+        auto* instance = ampoolnew(MemoryPoolKind::Filtering, ConvolutionReverbFilterInstance, this);
+        bool load = false;
+
+        {
+            std::lock_guard lock(_mutex);
+            _instancesCount++;
+
+            // Most sounds are mono or stereo, prepare the convolvers now instead of on the audio thread.
+            if (_loaded)
+            {
+                instance->InitChannels(2);
+            }
+            else
+            {
+                // The instance only outputs the dry signal until the impulse response is loaded.
+                _pendingInstances.push_back(instance);
+
+                load = !_loading;
+                _loading = true;
+            }
+        }
+
+        if (load)
+        {
+            auto task = std::shared_ptr<LoadImpulseResponseTask>(
+                ampoolnew(MemoryPoolKind::Engine, LoadImpulseResponseTask, this),
+                am_delete<MemoryPoolKind::Engine, LoadImpulseResponseTask>{});
+
+            // Without loader threads, the task is executed right away on the calling thread.
+            amEngine->GetState()->sound_data_loader.AddTask(task);
+        }
+
+        return instance;
+    }
+
+    void ConvolutionReverbFilter::DestroyInstance(FilterInstance* instance)
+    {
+        if (instance == nullptr)
+            return;
+
+        std::lock_guard lock(_mutex);
+
+        if (const auto it = std::find(_pendingInstances.begin(), _pendingInstances.end(), instance); it != _pendingInstances.end())
+            _pendingInstances.erase(it);
+
+        ampooldelete(MemoryPoolKind::Filtering, ConvolutionReverbFilterInstance, (ConvolutionReverbFilterInstance*)instance);
+
+        _instancesCount--;
+    }
+
+    AmResult ConvolutionReverbFilter::LoadImpulseResponse()
+    {
+        const auto finish = [this](AmResult result)
+        {
+            std::lock_guard lock(_mutex);
+
+            // The instances created while loading are prepared here, instead of on the audio thread.
+            if (result == AM_ERROR_NO_ERROR)
+            {
+                for (auto* instance : _pendingInstances)
+                    instance->InitChannels(2);
+
+                _pendingInstances.clear();
+            }
+
+            _loading = false;
+            _condition.notify_all();
+
+            return result;
+        };
+
+        const FileSystem* fs = amEngine->GetFileSystem();
+
+        if (!fs->Exists(_path))
+        {
+            CallLogFunc("[ERROR] Cannot load the impulse response: the file \"" AM_OS_CHAR_FMT "\" does not exist.\n", _path.c_str());
+            return finish(AM_ERROR_FILE_NOT_FOUND);
+        }
+
+        const auto file = fs->OpenFile(_path);
+
+        Codec* codec = Codec::FindCodecForFile(file);
+        if (codec == nullptr)
+        {
+            CallLogFunc("[ERROR] Cannot load the impulse response: unable to find codec for '" AM_OS_CHAR_FMT "'.\n", _path.c_str());
+            return finish(AM_ERROR_FILE_LOAD_FAILED);
+        }
+
+        Codec::Decoder* decoder = codec->AcquireDecoder();
+        if (!decoder->Reset(file))
+        {
+            CallLogFunc(
+                "[ERROR] Cannot load the impulse response: unable to initialize a decoder for '" AM_OS_CHAR_FMT "'.\n", _path.c_str());
+
+            codec->ReleaseDecoder(decoder);
+            return finish(AM_ERROR_FILE_LOAD_FAILED);
+        }
+
+        const SoundFormat& format = decoder->GetFormat();
+        const AmUInt64 frames = format.GetFramesCount();
+        const AmUInt16 channels = format.GetNumChannels();
+
+        if (frames == 0 || channels == 0)
+        {
+            CallLogFunc("[ERROR] Cannot load the impulse response: the file '" AM_OS_CHAR_FMT "' is empty.\n", _path.c_str());
+
+            codec->ReleaseDecoder(decoder);
+            return finish(AM_ERROR_FILE_LOAD_FAILED);
+        }
+
+        const AmSize size = frames * channels * sizeof(AmReal32);
+
+        auto* interleaved = static_cast<AmAudioSampleBuffer>(ampoolmalloc(MemoryPoolKind::Filtering, size));
+        const AmUInt64 loaded = decoder->Load(interleaved);
+
+        codec->ReleaseDecoder(decoder);
+
+        if (loaded == 0)
+        {
+            CallLogFunc("[ERROR] Cannot load the impulse response: unable to decode '" AM_OS_CHAR_FMT "'.\n", _path.c_str());
+
+            ampoolfree(MemoryPoolKind::Filtering, interleaved);
+            return finish(AM_ERROR_FILE_LOAD_FAILED);
+        }
+
+        // The convolvers read each channel as a contiguous array. Extra channels are ignored.
+        const AmUInt16 irChannels = AM_MIN(channels, static_cast<AmUInt16>(AM_MAX_CHANNELS));
+        auto* channel = static_cast<AmReal32Buffer>(ampoolmalloc(MemoryPoolKind::Filtering, loaded * sizeof(AmReal32)));
+
+        for (AmUInt16 c = 0; c < irChannels; c++)
+        {
+            for (AmUInt64 f = 0; f < loaded; f++)
+                channel[f] = interleaved[f * channels + c];
+
+            _prototypes[c] = ampoolnew(MemoryPoolKind::Filtering, TwoStageConvolver);
+            _prototypes[c]->Init(kHeadBlockSize, kTailBlockSize, channel, loaded);
+        }
+
+        ampoolfree(MemoryPoolKind::Filtering, channel);
+        ampoolfree(MemoryPoolKind::Filtering, interleaved);
+
+        {
+            std::lock_guard lock(_mutex);
+
+            _channels = irChannels;
+
+            // Impulse responses shorter than three tail blocks never use the background processing.
+            if (loaded > 3 * kTailBlockSize)
+            {
+                _workers.reset(ampoolnew(MemoryPoolKind::Filtering, Thread::Pool));
+                _workers->Init(kWorkerCount);
+            }
+
+            _loaded = true;
+        }
+
+        return finish(AM_ERROR_NO_ERROR);
+    }
+
+    void ConvolutionReverbFilter::DestroyPrototypes()
+    {
+        for (AmUInt16 c = 0; c < _channels; c++)
+        {
+            ampooldelete(MemoryPoolKind::Filtering, TwoStageConvolver, _prototypes[c]);
+            _prototypes[c] = nullptr;
+        }
+
+        _channels = 0;
+    }
+
+    ConvolutionReverbFilterInstance::ConvolutionReverbFilterInstance(ConvolutionReverbFilter* parent)
+        : FilterInstance(parent)
+        , _channels(0)
+        , _ready(false)
+        , _input()
+        , _output()
+    {
+        Init(parent->GetParamCount());
+
+        m_parameters[ConvolutionReverbFilter::ATTRIBUTE_WET] = 1.0f;
+        m_parameters[ConvolutionReverbFilter::ATTRIBUTE_DRY] = 0.0f;
+    }
+
+    ConvolutionReverbFilterInstance::~ConvolutionReverbFilterInstance()
+    {
+        InitChannels(0);
+    }
+
+    void ConvolutionReverbFilterInstance::InitChannels(AmUInt16 channels)
+    {
+        const auto* parent = static_cast<const ConvolutionReverbFilter*>(m_parent);
+
+        for (AmUInt16 c = channels; c < _channels; c++)
+        {
+            ampooldelete(MemoryPoolKind::Filtering, BackgroundConvolver, _convolvers[c]);
+            _convolvers[c] = nullptr;
+        }
+
+        for (AmUInt16 c = _channels; c < channels; c++)
+        {
+            _convolvers[c] = ampoolnew(MemoryPoolKind::Filtering, BackgroundConvolver, parent->_workers.get());
+
+            // Channels without their own impulse response use the last one.
+            const AmUInt16 ir = AM_MIN(c, parent->_channels - 1);
+            _convolvers[c]->Init(*parent->_prototypes[ir]);
+        }
+
+        _channels = channels;
+        _ready.store(channels > 0, std::memory_order_release);
+    }
+
+    void ConvolutionReverbFilterInstance::Process(
+        AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate)
+    {
+        UpdateParameters();
+
+        if (buffer == nullptr || frames == 0)
+            return;
+
+        AmReal32 wetStep, dryStep;
+        const AmReal32 wetStart = GetParameterRamp(ConvolutionReverbFilter::ATTRIBUTE_WET, frames, wetStep);
+        const AmReal32 dryStart = GetParameterRamp(ConvolutionReverbFilter::ATTRIBUTE_DRY, frames, dryStep);
+
+        // The impulse response is still loading, or failed to load.
+        if (!_ready.load(std::memory_order_acquire))
+        {
+            AmReal32 dry = dryStart;
+
+            for (AmUInt64 f = 0; f < frames; f++, dry += dryStep)
+            {
+                for (AmUInt16 c = 0; c < channels; c++)
+                    buffer[f * channels + c] = static_cast<AmAudioSample>(buffer[f * channels + c] * dry);
+            }
+
+            return;
+        }
+
+        // Only happens for sounds with more than two channels.
+        if (channels > _channels)
+            InitChannels(channels);
+
+        if (_input.GetSize() < frames)
+        {
+            _input.Resize(static_cast<AmUInt32>(frames));
+            _output.Resize(static_cast<AmUInt32>(frames));
+        }
+
+        AmReal32Buffer input = _input.GetBuffer();
+        AmReal32Buffer output = _output.GetBuffer();
+
+        for (AmUInt16 c = 0; c < channels; c++)
+        {
+            for (AmUInt64 f = 0; f < frames; f++)
+                input[f] = buffer[f * channels + c];
+
+            _convolvers[c]->Process(input, output, frames);
+
+            AmReal32 wet = wetStart, dry = dryStart;
+
+            for (AmUInt64 f = 0; f < frames; f++)
+            {
+                buffer[f * channels + c] = static_cast<AmAudioSample>(input[f] * dry + output[f] * wet);
+
+                wet += wetStep;
+                dry += dryStep;
+            }
+        }
+    }
+} // namespace SparkyStudios::Audio::Amplitude
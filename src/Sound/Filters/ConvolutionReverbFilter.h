@@ -0,0 +1,71 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef SS_AMPLITUDE_AUDIO_CONVOLUTION_REVERB_FILTER_INSTANCE_H
+#define SS_AMPLITUDE_AUDIO_CONVOLUTION_REVERB_FILTER_INSTANCE_H
+
+#include <SparkyStudios/Audio/Amplitude/Convolution/TwoStageConvolver.h>
+#include <SparkyStudios/Audio/Amplitude/Sound/ConvolutionReverbFilter.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    class BackgroundConvolverTask;
+
+    /**
+     * @brief A two-stage convolver running its tail convolution on a thread pool.
+     */
+    class BackgroundConvolver final : public Convolution::TwoStageConvolver
+    {
+        friend class BackgroundConvolverTask;
+
+    public:
+        explicit BackgroundConvolver(Thread::Pool* workers);
+        ~BackgroundConvolver() override;
+
+    protected:
+        void StartBackgroundProcessing() override;
+
+    private:
+        Thread::Pool* _workers;
+        std::shared_ptr<BackgroundConvolverTask> _task;
+    };
+
+    class ConvolutionReverbFilterInstance final : public FilterInstance
+    {
+        friend class ConvolutionReverbFilter;
+
+    public:
+        explicit ConvolutionReverbFilterInstance(ConvolutionReverbFilter* parent);
+        ~ConvolutionReverbFilterInstance() override;
+
+        void Process(
+            AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate) override;
+
+    private:
+        void InitChannels(AmUInt16 channels);
+
+        BackgroundConvolver* _convolvers[AM_MAX_CHANNELS]{};
+        AmUInt16 _channels;
+
+        // Set once the convolvers are initialized with the impulse response.
+        std::atomic<bool> _ready;
+
+        AmAlignedReal32Buffer _input;
+        AmAlignedReal32Buffer _output;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // SS_AMPLITUDE_AUDIO_CONVOLUTION_REVERB_FILTER_INSTANCE_H
@@ -62,39 +62,49 @@ namespace SparkyStudios::Audio::Amplitude
     void DCRemovalFilterInstance::Process(
         AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate)
     {
+        UpdateParameters();
+
         if (_buffer == nullptr)
         {
             InitBuffer(channels, sampleRate);
         }
 
-        for (AmInt64 i = 0; i < frames; i++)
-        {
-            for (AmUInt16 c = 0; c < channels; c++)
-            {
-                const AmUInt64 o = i * channels + c;
-                buffer[o] = ProcessSample(buffer[o], c, sampleRate);
-            }
+        if (buffer == nullptr || _bufferLength == 0)
+            return;
 
-            _offset = (_offset + 1) % _bufferLength;
-        }
-    }
+        AmReal32 wetStep;
+        const AmReal32 wetStart = GetParameterRamp(DCRemovalFilter::ATTRIBUTE_WET, frames, wetStep);
+        const AmReal32 scale = 1.0f / static_cast<AmReal32>(_bufferLength);
 
-    AmAudioSample DCRemovalFilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
-    {
-        const AmUInt64 o = _offset + channel * _bufferLength;
+        // Each channel has its own running sum, so channels are processed one after the other
+        // with the sum kept in a register for the whole block.
+        for (AmUInt16 c = 0; c < channels; c++)
+        {
+            AmReal32Buffer history = _buffer + c * _bufferLength;
+            AmReal32 total = _totals[c];
+            AmUInt64 offset = _offset;
+            AmReal32 wet = wetStart;
+
+            for (AmUInt64 i = c, l = frames * channels; i < l; i += channels)
+            {
+                const AmReal32 x = buffer[i];
 
-        const AmReal32 x = sample;
-        /* */ AmReal32 y;
+                total -= history[offset];
+                total += x;
+                history[offset] = x;
 
-        _totals[channel] -= _buffer[o];
-        _totals[channel] += x;
+                if (++offset == _bufferLength)
+                    offset = 0;
 
-        _buffer[o] = x;
+                const AmReal32 y = x - total * scale;
+                buffer[i] = static_cast<AmAudioSample>(x + (y - x) * wet);
+                wet += wetStep;
+            }
 
-        y = x - _totals[channel] / static_cast<AmReal32>(_bufferLength);
-        y = x + (y - x) * m_parameters[DCRemovalFilter::ATTRIBUTE_WET];
+            _totals[c] = total;
+        }
 
-        return static_cast<AmAudioSample>(y);
+        _offset = (_offset + frames) % _bufferLength;
     }
 
     void DCRemovalFilterInstance::InitBuffer(AmUInt16 channels, AmUInt32 sampleRate)
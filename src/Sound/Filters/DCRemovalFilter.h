@@ -32,8 +32,6 @@ namespace SparkyStudios::Audio::Amplitude
         void Process(
             AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate) override;
 
-        AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) override;
-
     private:
         void InitBuffer(AmUInt16 channels, AmUInt32 sampleRate);
 
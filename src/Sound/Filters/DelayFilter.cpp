@@ -15,6 +15,7 @@
 #include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
 
 #include <Sound/Filters/DelayFilter.h>
+#include <Utils/Utils.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
@@ -85,7 +86,6 @@ namespace SparkyStudios::Audio::Amplitude
     {
         _buffer = nullptr;
         _bufferLength = 0;
-        _bufferOffset = 0;
         _bufferMaxLength = 0;
         _offset = 0;
 
@@ -107,47 +107,78 @@ namespace SparkyStudios::Audio::Amplitude
     void DelayFilterInstance::Process(
         AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate)
     {
+        UpdateParameters();
+
         InitBuffer(channels, sampleRate);
 
-        for (AmUInt64 f = 0; f < frames; f++)
+        if (buffer == nullptr || _bufferLength == 0)
+            return;
+
+        // The wet and decay levels ramp per sample, the spans being interleaved.
+        AmReal32 wetStep, decayStep;
+        AmReal32 wet = GetParameterRamp(DelayFilter::ATTRIBUTE_WET, frames, wetStep);
+        AmReal32 decay = GetParameterRamp(DelayFilter::ATTRIBUTE_DECAY, frames, decayStep);
+        wetStep /= static_cast<AmReal32>(channels);
+        decayStep /= static_cast<AmReal32>(channels);
+        const bool delayStart = m_parameters[DelayFilter::ATTRIBUTE_DELAY_START] != 0.0f;
+
+        _offset %= _bufferLength;
+
+        // The delay line is interleaved like the input, so each run of frames until the end of the
+        // delay line is processed as a single contiguous span.
+        for (AmUInt64 f = 0; f < frames;)
         {
-            for (AmUInt16 c = 0; c < channels; c++)
-            {
-                _bufferOffset = _offset * channels + c;
+            const AmUInt64 run = AM_MIN(frames - f, static_cast<AmUInt64>(_bufferLength - _offset));
 
-                const AmUInt64 o = f * channels + c;
-                buffer[o] = ProcessSample(buffer[o], c, sampleRate);
-            }
+            ProcessSpan(buffer + f * channels, _buffer + _offset * channels, run * channels, wet, wetStep, decay, decayStep, delayStart);
 
-            _offset = (_offset + 1) % _bufferLength;
+            f += run;
+            _offset = (_offset + run) % _bufferLength;
         }
     }
 
-    AmAudioSample DelayFilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
+    void DelayFilterInstance::ProcessSpan(
+        AmAudioSampleBuffer buffer,
+        AmReal32Buffer delay,
+        AmSize length,
+        AmReal32& wet,
+        AmReal32 wetStep,
+        AmReal32& decay,
+        AmReal32 decayStep,
+        bool delayStart)
     {
-        const AmUInt32 o = _bufferOffset;
+        AmSize i = 0;
 
-        const AmReal32 x = sample;
-        /* */ AmReal32 y;
+#if defined(AM_SIMD_INTRINSICS)
+        // Spans with ramping levels only happen after a parameter change, they use the scalar loop.
+        const AmSize end = wetStep == 0.0f && decayStep == 0.0f ? AmAudioFrame::size * (length / AmAudioFrame::size) : 0;
 
-        if (m_parameters[DelayFilter::ATTRIBUTE_DELAY_START] != 0.0f)
+        const AmAudioFrame bw(wet), bd(decay);
+
+        for (; i < end; i += AmAudioFrame::size)
         {
-            // Read first
-            y = _buffer[o] * m_parameters[DelayFilter::ATTRIBUTE_WET];
+            const auto x = AmAudioFrame::load_unaligned(&buffer[i]);
+            const auto d = AmAudioFrame::load_unaligned(&delay[i]);
+            const auto feedback = xsimd::fma(d, bd, x);
+
+            // Read before producing the feedback, or after it to produce an echo.
+            const auto y = (delayStart ? d : feedback) * bw;
 
-            // Produce feedback
-            _buffer[o] = _buffer[o] * m_parameters[DelayFilter::ATTRIBUTE_DECAY] + x;
+            feedback.store_unaligned(&delay[i]);
+            y.store_unaligned(&buffer[i]);
         }
-        else
+#endif // AM_SIMD_INTRINSICS
+
+        for (; i < length; ++i)
         {
-            // Produce feedback first
-            _buffer[o] = _buffer[o] * m_parameters[DelayFilter::ATTRIBUTE_DECAY] + x;
+            const AmReal32 d = delay[i];
+            const AmReal32 feedback = d * decay + buffer[i];
 
-            // Read
-            y = _buffer[o] * m_parameters[DelayFilter::ATTRIBUTE_WET];
+            delay[i] = feedback;
+            buffer[i] = static_cast<AmAudioSample>((delayStart ? d : feedback) * wet);
+            wet += wetStep;
+            decay += decayStep;
         }
-
-        return static_cast<AmAudioSample>(y);
     }
 
     void DelayFilterInstance::InitBuffer(AmUInt16 channels, AmUInt32 sampleRate)
@@ -158,7 +189,6 @@ namespace SparkyStudios::Audio::Amplitude
         if (_buffer == nullptr)
         {
             _offset = 0;
-            _bufferOffset = 0;
 
             _bufferMaxLength = maxSamples;
             const AmUInt32 size = _bufferMaxLength * channels * sizeof(AmReal32);
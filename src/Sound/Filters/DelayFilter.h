@@ -32,15 +32,22 @@ namespace SparkyStudios::Audio::Amplitude
         void Process(
             AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate) override;
 
-        AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) override;
-
     private:
         void InitBuffer(AmUInt16 channels, AmUInt32 sampleRate);
 
+        static void ProcessSpan(
+            AmAudioSampleBuffer buffer,
+            AmReal32Buffer delay,
+            AmSize length,
+            AmReal32& wet,
+            AmReal32 wetStep,
+            AmReal32& decay,
+            AmReal32 decayStep,
+            bool delayStart);
+
         AmReal32Buffer _buffer;
         AmUInt32 _bufferLength;
         AmUInt32 _bufferMaxLength;
-        AmUInt32 _bufferOffset;
         AmUInt32 _offset;
     };
 
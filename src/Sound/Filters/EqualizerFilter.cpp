@@ -15,12 +15,31 @@
 #include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
 
 #include <Sound/Filters/EqualizerFilter.h>
-#include <Utils/Utils.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    constexpr AmUInt32 kEqualizerBandsCount = EqualizerFilter::ATTRIBUTE_LAST - EqualizerFilter::ATTRIBUTE_BAND_1;
+
+    // The center frequencies of the peaking bands, and the corner frequencies of the shelves, relative to the Nyquist
+    // frequency. They follow the square root warping of the previous FFT equalizer, which reached the gain of the band n
+    // at (n / 8)^2 times the Nyquist frequency. The shelves turn halfway between their band and the next one.
+    constexpr AmReal32 kEqualizerFrequencies[kEqualizerBandsCount] = {
+        2.0f / 64.0f, 4.0f / 64.0f, 9.0f / 64.0f, 16.0f / 64.0f, 25.0f / 64.0f, 36.0f / 64.0f, 49.0f / 64.0f, 56.0f / 64.0f,
+    };
+
+    // The quality factors of the peaking bands, reaching the centers of the neighboring bands: sqrt(n^2 - 1) / 2.
+    constexpr AmReal32 kEqualizerQ[kEqualizerBandsCount] = {
+        0.0f, 0.8660254f, 1.4142136f, 1.9364917f, 2.4494897f, 2.9580399f, 3.4641016f, 0.0f,
+    };
+
+    // The lowest gain a band can apply, about -60 dB.
+    constexpr AmReal32 kEqualizerMinimum = 0.001f;
+
+    // The number of frames equalized at once when mixing with the dry signal.
+    constexpr AmUInt64 kEqualizerChunkFrames = 256;
+
     EqualizerFilter::EqualizerFilter()
-        : FFTFilter("Equalizer")
+        : Filter("Equalizer")
         , _volume{}
     {
         for (float& i : _volume)
@@ -134,9 +153,16 @@ namespace SparkyStudios::Audio::Amplitude
     }
 
     EqualizerFilterInstance::EqualizerFilterInstance(EqualizerFilter* parent)
-        : FFTFilterInstance(parent)
+        : FilterInstance(parent)
+        , _cascade()
+        , _sampleRate(0)
+        , _dry(nullptr)
     {
         Init(parent->GetParamCount());
+        _cascade.Initialize(AM_MAX_CHANNELS, kEqualizerBandsCount);
+
+        _dry = static_cast<AmReal32Buffer>(
+            ampoolmalloc(MemoryPoolKind::Filtering, kEqualizerChunkFrames * AM_MAX_CHANNELS * sizeof(AmReal32)));
 
         m_parameters[EqualizerFilter::ATTRIBUTE_BAND_1] =
             parent->_volume[EqualizerFilter::ATTRIBUTE_BAND_1 - EqualizerFilter::ATTRIBUTE_BAND_1];
@@ -156,34 +182,82 @@ namespace SparkyStudios::Audio::Amplitude
             parent->_volume[EqualizerFilter::ATTRIBUTE_BAND_8 - EqualizerFilter::ATTRIBUTE_BAND_1];
     }
 
-    void EqualizerFilterInstance::ProcessFFTChannel(
-        SplitComplex& fft, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate)
+    EqualizerFilterInstance::~EqualizerFilterInstance()
     {
-        Comp2MagPhase(fft, frames / 2);
+        ampoolfree(MemoryPoolKind::Filtering, _dry);
+        _dry = nullptr;
+    }
 
-        for (AmUInt32 p = 0; p < frames / 2; p++)
+    void EqualizerFilterInstance::Process(
+        AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate)
+    {
+        UpdateParameters();
+
+        if (buffer == nullptr)
+            return;
+
+        // The coefficients of a new filter are applied right away, later changes are interpolated over the block.
+        const bool reset = _cascade.GetLaneCount() != channels;
+        if (reset)
+            _cascade.SetLaneCount(channels);
+
+        // The wet level doesn't change the bands.
+        const bool bandsChanged = (m_numParamsChanged & ~(1 << EqualizerFilter::ATTRIBUTE_WET)) != 0;
+
+        if (reset || bandsChanged || sampleRate != _sampleRate)
         {
-            const auto i = static_cast<AmInt32>(std::floor(std::sqrt(p / (AmReal32)(frames / 2)) * (frames / 2)));
-
-            AmInt32 p2 = (i / (frames / 16));
-            AmInt32 p1 = p2 - 1;
-            AmInt32 p0 = p1 - 1;
-            AmInt32 p3 = p2 + 1;
-
-            if (p1 < 0)
-                p1 = 0;
-            if (p0 < 0)
-                p0 = 0;
-            if (p3 > 7)
-                p3 = 7;
-
-            const AmReal32 v = static_cast<AmReal32>((i % (frames / 16))) / (AmReal32)(frames / 16);
-            fft.re()[p] *= CatmullRom(v, m_parameters[p0 + 1], m_parameters[p1 + 1], m_parameters[p2 + 1], m_parameters[p3 + 1]);
+            _sampleRate = sampleRate;
+
+            const AmReal32 nyquist = 0.5f * static_cast<AmReal32>(sampleRate);
+
+            for (AmUInt32 b = 0; b < kEqualizerBandsCount; b++)
+            {
+                const AmReal32 frequency = kEqualizerFrequencies[b] * nyquist;
+                const AmReal32 volume = AM_MAX(m_parameters[EqualizerFilter::ATTRIBUTE_BAND_1 + b], kEqualizerMinimum);
+                const AmReal32 gain = 20.0f * std::log10(volume);
+
+                BiquadCoefficients coefficients;
+                if (b == 0)
+                    coefficients = BiquadCoefficients::LowShelf(frequency, 1.0f, gain, sampleRate);
+                else if (b == kEqualizerBandsCount - 1)
+                    coefficients = BiquadCoefficients::HighShelf(frequency, 1.0f, gain, sampleRate);
+                else
+                    coefficients = BiquadCoefficients::Peak(frequency, kEqualizerQ[b], gain, sampleRate);
+
+                for (AmUInt16 c = 0; c < channels; c++)
+                    _cascade.SetCoefficients(b, c, coefficients, !reset);
+            }
+        }
+
+        m_numParamsChanged = 0;
+
+        AmReal32 wetStep;
+        AmReal32 wet = GetParameterRamp(EqualizerFilter::ATTRIBUTE_WET, frames, wetStep);
+
+        if (wet >= 1.0f && wetStep == 0.0f)
+        {
+            _cascade.ProcessInterleaved(buffer, frames);
+            return;
         }
 
-        std::memset(fft.re() + frames / 2, 0, sizeof(AmReal32) * frames / 2);
-        std::memset(fft.im() + frames / 2, 0, sizeof(AmReal32) * frames / 2);
+        for (AmUInt64 f = 0; f < frames;)
+        {
+            const AmUInt64 run = AM_MIN(frames - f, kEqualizerChunkFrames);
+            AmAudioSampleBuffer chunk = buffer + f * channels;
+
+            std::memcpy(_dry, chunk, run * channels * sizeof(AmReal32));
+            _cascade.ProcessInterleaved(chunk, run);
+
+            for (AmUInt64 i = 0; i < run; i++, wet += wetStep)
+            {
+                for (AmUInt16 c = 0; c < channels; c++)
+                {
+                    const AmUInt64 s = i * channels + c;
+                    chunk[s] = _dry[s] + (chunk[s] - _dry[s]) * wet;
+                }
+            }
 
-        MagPhase2Comp(fft, frames / 2);
+            f += run;
+        }
     }
 } // namespace SparkyStudios::Audio::Amplitude
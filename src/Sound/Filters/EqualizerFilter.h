@@ -17,22 +17,41 @@
 #ifndef SS_AMPLITUDE_AUDIO_EQUALIZERFILTER_H
 #define SS_AMPLITUDE_AUDIO_EQUALIZERFILTER_H
 
-#include <Sound/Filters/FFTFilter.h>
+#include <SparkyStudios/Audio/Amplitude/Sound/Filter.h>
+
+#include <Utils/Audio/Filters/BiquadCascade.h>
 
 namespace SparkyStudios::Audio::Amplitude
 {
     class EqualizerFilter;
 
-    class EqualizerFilterInstance : public FFTFilterInstance
+    class EqualizerFilterInstance : public FilterInstance
     {
     public:
         explicit EqualizerFilterInstance(EqualizerFilter* parent);
-        ~EqualizerFilterInstance() override = default;
+        ~EqualizerFilterInstance() override;
+
+        void Process(
+            AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate) override;
+
+    private:
+        BiquadCascade _cascade;
+        AmUInt32 _sampleRate;
 
-        void ProcessFFTChannel(SplitComplex& fft, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate) override;
+        // A copy of the input, mixed back with the equalized signal following the wet level.
+        AmReal32Buffer _dry;
     };
 
-    [[maybe_unused]] static class EqualizerFilter final : public FFTFilter
+    /**
+     * @brief An 8 bands parametric equalizer.
+     *
+     * Each band is a stage of a biquad cascade, with a low shelf for the first band, a high shelf
+     * for the last one, and peaking filters for the others. The bands cover the same frequencies
+     * as the previous FFT equalizer: the center of the band n is at (n / 8)^2 times the Nyquist
+     * frequency, that is from 375 Hz up to 24 kHz at 48 kHz. The band parameters are linear gains,
+     * and the wet parameter mixes the equalized signal with the input.
+     */
+    [[maybe_unused]] static class EqualizerFilter final : public Filter
     {
         friend class EqualizerFilterInstance;
 
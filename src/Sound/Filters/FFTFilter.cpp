@@ -23,14 +23,12 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
-    // Create a hamming window of STFT_WINDOW_SIZE samples in buffer
-    AM_API_PRIVATE void hamming(AmReal32Buffer buffer)
-    {
-        for (int i = 0; i < STFT_WINDOW_SIZE; i++)
-        {
-            buffer[i] = 0.54 - (0.46f * std::cos(2.0 * M_PI * (i / ((STFT_WINDOW_SIZE - 1) * 1.0))));
-        }
-    }
+    // Windows overlap by half. A hop of output is complete once the window starting with it is processed.
+    constexpr AmUInt32 kSTFTHopSize = STFT_WINDOW_HALF;
+    constexpr AmUInt32 kSTFTOverlap = STFT_WINDOW_SIZE - kSTFTHopSize;
+
+    // Each channel stores its input, output and overlap-add buffers.
+    constexpr AmUInt32 kSTFTChannelSize = 3 * STFT_WINDOW_SIZE;
 
     FFTFilter::FFTFilter(const std::string& name)
         : Filter(name)
@@ -55,62 +53,107 @@ namespace SparkyStudios::Audio::Amplitude
 
     FFTFilterInstance::~FFTFilterInstance()
     {
+        ampoolfree(MemoryPoolKind::Filtering, _window);
         ampoolfree(MemoryPoolKind::Filtering, _temp);
+        ampoolfree(MemoryPoolKind::Filtering, _channelData);
     }
 
     void FFTFilterInstance::InitFFT()
     {
+        _fft.Initialize(STFT_WINDOW_SIZE);
+
         _temp = static_cast<AmReal32Buffer>(ampoolmalloc(MemoryPoolKind::Filtering, STFT_WINDOW_SIZE * sizeof(AmReal32)));
+        _window = static_cast<AmReal32Buffer>(ampoolmalloc(MemoryPoolKind::Filtering, STFT_WINDOW_SIZE * sizeof(AmReal32)));
+
+        // The window is applied before and after the transform. The square root of a periodic Hann
+        // window makes the overlapped windows sum to one.
+        for (AmUInt32 i = 0; i < STFT_WINDOW_SIZE; i++)
+            _window[i] = std::sqrt(0.5f * (1.0f - std::cos(2.0f * static_cast<AmReal32>(M_PI) * i / STFT_WINDOW_SIZE)));
+    }
+
+    void FFTFilterInstance::InitChannels(AmUInt16 channels)
+    {
+        ampoolfree(MemoryPoolKind::Filtering, _channelData);
+
+        const AmSize size = channels * kSTFTChannelSize * sizeof(AmReal32);
+
+        _channelData = static_cast<AmReal32Buffer>(ampoolmalloc(MemoryPoolKind::Filtering, size));
+        std::memset(_channelData, 0, size);
+
+        for (AmUInt32& position : _positions)
+            position = kSTFTOverlap;
+
+        _channels = channels;
+    }
+
+    void FFTFilterInstance::Process(
+        AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate)
+    {
+        UpdateParameters();
+
+        if (buffer == nullptr)
+            return;
+
+        if (channels != _channels)
+            InitChannels(channels);
+
+        for (AmUInt16 c = 0; c < channels; c++)
+            ProcessChannel(buffer, c, frames, channels, sampleRate);
     }
 
     void FFTFilterInstance::ProcessChannel(
         AmAudioSampleBuffer buffer, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate)
     {
-        AmUInt32 offset = 0;
+        AmReal32Buffer input = _channelData + channel * kSTFTChannelSize;
+        AmReal32Buffer output = input + STFT_WINDOW_SIZE;
 
-        while (offset < frames)
-        {
-            AmUInt32 framesToProcess = frames - offset;
-            if (framesToProcess > STFT_WINDOW_SIZE)
-                framesToProcess = STFT_WINDOW_SIZE;
+        AmUInt32 position = _positions[channel];
 
-            for (AmUInt32 i = 0; i < framesToProcess; i++)
-            {
-                const AmUInt32 o = (offset + i) * channels + channel;
+        for (AmUInt64 f = 0; f < frames; f++)
+        {
+            const AmUInt64 o = f * channels + channel;
 
-                _temp[i] = buffer[o];
-            }
+            input[position] = buffer[o];
+            buffer[o] = static_cast<AmAudioSample>(output[position - kSTFTOverlap]);
 
-            if (framesToProcess < STFT_WINDOW_SIZE)
-                std::memset(_temp + framesToProcess, 0, sizeof(AmReal32) * (STFT_WINDOW_SIZE - framesToProcess));
+            if (++position < STFT_WINDOW_SIZE)
+                continue;
 
-            {
-                FFT fft;
-                SplitComplex sc;
+            ProcessWindow(channel, channels, sampleRate);
+            position = kSTFTOverlap;
+        }
 
-                fft.Initialize(STFT_WINDOW_SIZE);
+        _positions[channel] = position;
+    }
 
-                fft.Forward(_temp, sc);
+    void FFTFilterInstance::ProcessWindow(AmUInt16 channel, AmUInt16 channels, AmUInt32 sampleRate)
+    {
+        AmReal32Buffer input = _channelData + channel * kSTFTChannelSize;
+        AmReal32Buffer output = input + STFT_WINDOW_SIZE;
+        AmReal32Buffer accumulator = output + STFT_WINDOW_SIZE;
 
-                ProcessFFTChannel(sc, channel, STFT_WINDOW_HALF, channels, sampleRate);
+        for (AmUInt32 i = 0; i < STFT_WINDOW_SIZE; i++)
+            _temp[i] = input[i] * _window[i];
 
-                fft.Backward(_temp, sc);
-            }
+        _fft.Forward(_temp, _spectrum);
+        ProcessFFTChannel(_spectrum, channel, STFT_WINDOW_HALF, channels, sampleRate);
+        _fft.Backward(_temp, _spectrum);
 
-            for (AmUInt32 i = 0; i < framesToProcess; i++)
-            {
-                const AmUInt32 o = (offset + i) * channels + channel;
+        for (AmUInt32 i = 0; i < STFT_WINDOW_SIZE; i++)
+            accumulator[i] += _temp[i] * _window[i];
 
-                const AmReal32 x = buffer[o];
-                /* */ AmReal32 y = _temp[i];
+        // The first hop is complete, the rest still waits for the next window. It is mixed with
+        // the dry input of the same frames, so both signals have the same latency.
+        const AmReal32 wet = m_parameters[0];
 
-                y = x + (y - x) * m_parameters[0];
+        for (AmUInt32 i = 0; i < kSTFTHopSize; i++)
+            output[i] = input[i] + (accumulator[i] - input[i]) * wet;
 
-                buffer[o] = static_cast<AmAudioSample>(y);
-            }
+        std::memmove(accumulator, accumulator + kSTFTHopSize, kSTFTOverlap * sizeof(AmReal32));
+        std::memset(accumulator + kSTFTOverlap, 0, kSTFTHopSize * sizeof(AmReal32));
 
-            offset += framesToProcess;
-        }
+        // Keep the end of the window, it starts the next one.
+        std::memmove(input, input + kSTFTHopSize, kSTFTOverlap * sizeof(AmReal32));
     }
 
     void FFTFilterInstance::Comp2MagPhase(SplitComplex& fft, AmUInt32 samples)
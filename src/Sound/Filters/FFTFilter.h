@@ -17,6 +17,7 @@
 #ifndef SS_AMPLITUDE_AUDIO_FFT_FILTER_H
 #define SS_AMPLITUDE_AUDIO_FFT_FILTER_H
 
+#include <SparkyStudios/Audio/Amplitude/Math/FFT.h>
 #include <SparkyStudios/Audio/Amplitude/Math/SplitComplex.h>
 
 #include <SparkyStudios/Audio/Amplitude/Sound/Filter.h>
@@ -37,12 +38,22 @@ namespace SparkyStudios::Audio::Amplitude
         void DestroyInstance(FilterInstance* instance) override;
     };
 
+    /**
+     * @brief Base class for filters working in the frequency domain.
+     *
+     * The input is split into windows of 256 frames overlapping by half, which are transformed
+     * with a FFT and given to ProcessFFTChannel(). The processed windows are transformed back
+     * and overlap-added to build the output. The output is delayed by 256 frames.
+     */
     class FFTFilterInstance : public FilterInstance
     {
     public:
         explicit FFTFilterInstance(FFTFilter* parent);
         ~FFTFilterInstance() override;
 
+        void Process(
+            AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate) override;
+
         void ProcessChannel(AmAudioSampleBuffer buffer, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate)
             override;
 
@@ -57,7 +68,19 @@ namespace SparkyStudios::Audio::Amplitude
         void InitFFT();
 
     private:
+        void InitChannels(AmUInt16 channels);
+        void ProcessWindow(AmUInt16 channel, AmUInt16 channels, AmUInt32 sampleRate);
+
+        FFT _fft;
+        SplitComplex _spectrum;
+
+        AmReal32Buffer _window = nullptr;
         AmReal32Buffer _temp = nullptr;
+
+        // Input, output and overlap-add buffers of each channel.
+        AmReal32Buffer _channelData = nullptr;
+        AmUInt32 _positions[AM_MAX_CHANNELS]{};
+        AmUInt16 _channels = 0;
     };
 } // namespace SparkyStudios::Audio::Amplitude
 
@@ -105,9 +105,12 @@ namespace SparkyStudios::Audio::Amplitude
     void FlangerFilterInstance::Process(
         AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate)
     {
+        UpdateParameters();
+
         InitBuffer(channels, sampleRate);
 
-        FilterInstance::Process(buffer, frames, bufferSize, channels, sampleRate);
+        for (AmUInt16 c = 0; c < channels; c++)
+            ProcessChannel(buffer, c, frames, channels, sampleRate);
 
         _offset += frames;
         _offset %= _bufferLength;
@@ -120,7 +123,14 @@ namespace SparkyStudios::Audio::Amplitude
             static_cast<AmUInt32>(std::ceil(m_parameters[FlangerFilter::ATTRIBUTE_DELAY] * static_cast<AmReal32>(sampleRate)));
 
         const AmUInt64 o = channel * _bufferLength;
-        const AmReal64 i = m_parameters[FlangerFilter::ATTRIBUTE_FREQUENCY] * M_PI * 2 / static_cast<AmReal64>(sampleRate);
+
+        AmReal32 wetStep, frequencyStep;
+        AmReal32 wet = GetParameterRamp(FlangerFilter::ATTRIBUTE_WET, frames, wetStep);
+        const AmReal32 frequency = GetParameterRamp(FlangerFilter::ATTRIBUTE_FREQUENCY, frames, frequencyStep);
+
+        // The phase increment of the oscillator ramps with the frequency.
+        AmReal64 i = frequency * M_PI * 2 / static_cast<AmReal64>(sampleRate);
+        const AmReal64 iStep = frequencyStep * M_PI * 2 / static_cast<AmReal64>(sampleRate);
 
         for (AmUInt64 f = 0; f < frames; f++)
         {
@@ -128,6 +138,7 @@ namespace SparkyStudios::Audio::Amplitude
 
             const auto delay = static_cast<AmInt32>(std::floor(static_cast<AmReal64>(maxSamples) * (1 + std::cos(_index))) / 2);
             _index += i;
+            i += iStep;
 
             const AmReal32 x = buffer[s];
             /* */ AmReal32 y;
@@ -137,7 +148,8 @@ namespace SparkyStudios::Audio::Amplitude
             y = 0.5f * (x + _buffer[o + (_bufferLength - delay + _offset) % _bufferLength]);
             _offset++;
 
-            y = x + (y - x) * m_parameters[FlangerFilter::ATTRIBUTE_WET];
+            y = x + (y - x) * wet;
+            wet += wetStep;
 
             buffer[s] = static_cast<AmAudioSample>(y);
         }
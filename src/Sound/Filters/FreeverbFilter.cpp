@@ -18,6 +18,9 @@
 
 namespace SparkyStudios::Audio::Amplitude
 {
+    // The number of frames processed with the same parameters while they ramp.
+    constexpr AmUInt64 kRampFrames = 32;
+
     FreeverbFilter::FreeverbFilter()
         : Filter("Freeverb")
         , _roomSize(0.5f)
@@ -116,20 +119,48 @@ namespace SparkyStudios::Audio::Amplitude
     void FreeverbFilterInstance::Process(
         AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate)
     {
-        if (m_numParamsChanged > 0)
+        UpdateParameters();
+
+        if (m_numParamsChanged == 0)
         {
-            _model->SetDamp(m_parameters[FreeverbFilter::ATTRIBUTE_DAMP]);
-            _model->SetMode(m_parameters[FreeverbFilter::ATTRIBUTE_MODE]);
-            _model->SetRoomSize(m_parameters[FreeverbFilter::ATTRIBUTE_ROOM_SIZE]);
-            _model->SetWidth(m_parameters[FreeverbFilter::ATTRIBUTE_WIDTH]);
-            _model->SetWet(m_parameters[FreeverbFilter::ATTRIBUTE_WET]);
-            _model->SetDry(m_parameters[FreeverbFilter::ATTRIBUTE_DRY]);
-            m_numParamsChanged = 0;
+            _model->ProcessReplace(buffer, buffer + (channels - 1), buffer, buffer + (channels - 1), frames, channels);
+            return;
+        }
+
+        // The mode switches the reverb between frozen and running, it's applied at once.
+        _model->SetMode(m_parameters[FreeverbFilter::ATTRIBUTE_MODE]);
+
+        AmReal32 dampStep, roomSizeStep, widthStep, wetStep, dryStep;
+        AmReal32 damp = GetParameterRamp(FreeverbFilter::ATTRIBUTE_DAMP, frames, dampStep);
+        AmReal32 roomSize = GetParameterRamp(FreeverbFilter::ATTRIBUTE_ROOM_SIZE, frames, roomSizeStep);
+        AmReal32 width = GetParameterRamp(FreeverbFilter::ATTRIBUTE_WIDTH, frames, widthStep);
+        AmReal32 wet = GetParameterRamp(FreeverbFilter::ATTRIBUTE_WET, frames, wetStep);
+        AmReal32 dry = GetParameterRamp(FreeverbFilter::ATTRIBUTE_DRY, frames, dryStep);
+
+        // Updating the model recomputes the coefficients of all the combs, so the parameters ramp
+        // in steps of kRampFrames frames instead of every frame.
+        for (AmUInt64 f = 0; f < frames; f += kRampFrames)
+        {
+            const AmUInt64 length = AM_MIN(kRampFrames, frames - f);
+            const auto progress = static_cast<AmReal32>(f);
+
+            _model->SetDamp(damp + dampStep * progress);
+            _model->SetRoomSize(roomSize + roomSizeStep * progress);
+            _model->SetWidth(width + widthStep * progress);
+            _model->SetWet(wet + wetStep * progress);
+            _model->SetDry(dry + dryStep * progress);
+
+            AmAudioSampleBuffer block = buffer + f * channels;
+            _model->ProcessReplace(block, block + (channels - 1), block, block + (channels - 1), length, channels);
         }
 
-        auto* input = buffer;
-        auto* output = buffer;
+        // Settle on the current values, the next blocks won't update the model until they change again.
+        _model->SetDamp(m_parameters[FreeverbFilter::ATTRIBUTE_DAMP]);
+        _model->SetRoomSize(m_parameters[FreeverbFilter::ATTRIBUTE_ROOM_SIZE]);
+        _model->SetWidth(m_parameters[FreeverbFilter::ATTRIBUTE_WIDTH]);
+        _model->SetWet(m_parameters[FreeverbFilter::ATTRIBUTE_WET]);
+        _model->SetDry(m_parameters[FreeverbFilter::ATTRIBUTE_DRY]);
 
-        _model->ProcessReplace(input, input + (channels - 1), output, output + (channels - 1), frames, channels);
+        m_numParamsChanged = 0;
     }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -107,21 +107,52 @@ namespace SparkyStudios::Audio::Amplitude
         }
     }
 
-    AmAudioSample LofiFilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
+    void LofiFilterInstance::ProcessChannel(
+        AmAudioSampleBuffer buffer, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate)
     {
-        if (_channelData[channel].m_samplesToSkip <= 0)
-        {
-            _channelData[channel].m_samplesToSkip += (sampleRate / m_parameters[LofiFilter::ATTRIBUTE_SAMPLERATE]) - 1;
-            AmReal32 q = std::pow(2.0f, m_parameters[LofiFilter::ATTRIBUTE_BITDEPTH]);
-            _channelData[channel].m_sample = std::floor(q * sample) / q;
-        }
-        else
+        LofiChannelData& data = _channelData[channel];
+
+        AmReal32 wetStep, sampleRateStep, bitDepthStep;
+        AmReal32 wet = GetParameterRamp(LofiFilter::ATTRIBUTE_WET, frames, wetStep);
+        AmReal32 targetSampleRate = GetParameterRamp(LofiFilter::ATTRIBUTE_SAMPLERATE, frames, sampleRateStep);
+        AmReal32 bitDepth = GetParameterRamp(LofiFilter::ATTRIBUTE_BITDEPTH, frames, bitDepthStep);
+
+        // The sample rate and bit depth only change between blocks most of the time. While they ramp,
+        // they are recomputed each time a new sample is held.
+        const bool ramping = sampleRateStep != 0.0f || bitDepthStep != 0.0f;
+        AmReal32 skip = (sampleRate / targetSampleRate) - 1;
+        AmReal32 q = std::pow(2.0f, bitDepth);
+
+        AmReal32 held = data.m_sample;
+        AmReal32 samplesToSkip = data.m_samplesToSkip;
+
+        for (AmUInt64 i = channel, l = frames * channels; i < l; i += channels)
         {
-            _channelData[channel].m_samplesToSkip--;
+            const AmReal32 x = buffer[i];
+
+            if (samplesToSkip <= 0)
+            {
+                if (ramping)
+                {
+                    skip = (sampleRate / targetSampleRate) - 1;
+                    q = std::pow(2.0f, bitDepth);
+                }
+
+                samplesToSkip += skip;
+                held = std::floor(q * x) / q;
+            }
+            else
+            {
+                samplesToSkip--;
+            }
+
+            buffer[i] = static_cast<AmAudioSample>(x + (held - x) * wet);
+            wet += wetStep;
+            targetSampleRate += sampleRateStep;
+            bitDepth += bitDepthStep;
         }
 
-        AmReal32 y = sample + (_channelData[channel].m_sample - sample) * m_parameters[LofiFilter::ATTRIBUTE_WET];
-
-        return static_cast<AmAudioSample>(y);
+        data.m_sample = held;
+        data.m_samplesToSkip = samplesToSkip;
     }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -35,7 +35,8 @@ namespace SparkyStudios::Audio::Amplitude
         explicit LofiFilterInstance(LofiFilter* parent);
         ~LofiFilterInstance() override = default;
 
-        AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) override;
+        void ProcessChannel(AmAudioSampleBuffer buffer, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate)
+            override;
 
     private:
         LofiChannelData _channelData[AM_MAX_CHANNELS]{};
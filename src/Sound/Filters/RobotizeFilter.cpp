@@ -102,9 +102,19 @@ namespace SparkyStudios::Audio::Amplitude
     void RobotizeFilterInstance::ProcessChannel(
         AmAudioSampleBuffer buffer, AmUInt16 channel, AmUInt64 frames, AmUInt16 channels, AmUInt32 sampleRate)
     {
-        const auto period = static_cast<AmInt32>(static_cast<AmReal32>(sampleRate) / m_parameters[RobotizeFilter::ATTRIBUTE_FREQUENCY]);
+        AmReal32 wetStep, frequencyStep;
+        AmReal32 wet = GetParameterRamp(RobotizeFilter::ATTRIBUTE_WET, frames, wetStep);
+        AmReal32 frequency = GetParameterRamp(RobotizeFilter::ATTRIBUTE_FREQUENCY, frames, frequencyStep);
+
+        const auto period = static_cast<AmInt32>(static_cast<AmReal32>(sampleRate) / frequency);
         const auto start = static_cast<AmInt32>(_duration * sampleRate) % period;
 
+        // While the frequency ramps, the position in the waveform is accumulated instead of derived
+        // from a fixed period, so that it never jumps.
+        AmReal32 phase = static_cast<AmReal32>(start + channel) / static_cast<AmReal32>(period);
+        frequencyStep /= static_cast<AmReal32>(sampleRate);
+        frequency /= static_cast<AmReal32>(sampleRate);
+
         for (AmUInt64 f = 0; f < frames; f++)
         {
             const AmUInt64 s = f * channels + channel;
@@ -112,11 +122,22 @@ namespace SparkyStudios::Audio::Amplitude
             const AmReal32 x = buffer[s];
             /* */ AmReal32 y;
 
-            const AmReal32 wPos = static_cast<AmReal32>((start + s) % period) / static_cast<AmReal32>(period);
+            AmReal32 wPos;
+            if (frequencyStep == 0.0f)
+            {
+                wPos = static_cast<AmReal32>((start + s) % period) / static_cast<AmReal32>(period);
+            }
+            else
+            {
+                wPos = phase - std::floor(phase);
+                phase += frequency * static_cast<AmReal32>(channels);
+                frequency += frequencyStep;
+            }
 
             y = x * (GenerateWaveform(static_cast<AmInt32>(m_parameters[RobotizeFilter::ATTRIBUTE_WAVEFORM]), wPos) + 0.5f);
 
-            y = x + (y - x) * m_parameters[RobotizeFilter::ATTRIBUTE_WET];
+            y = x + (y - x) * wet;
+            wet += wetStep;
 
             buffer[s] = static_cast<AmAudioSample>(y);
         }
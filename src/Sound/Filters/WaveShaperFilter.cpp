@@ -75,6 +75,11 @@ namespace SparkyStudios::Audio::Amplitude
         ampooldelete(MemoryPoolKind::Filtering, WaveShaperFilterInstance, (WaveShaperFilterInstance*)instance);
     }
 
+    static AmReal32 GetShapingFactor(AmReal32 amount)
+    {
+        return std::abs(amount - 1.0f) < kEpsilon ? 2 * amount / 0.01f : 2 * amount / (1 - amount);
+    }
+
     WaveShaperFilterInstance::WaveShaperFilterInstance(WaveShaperFilter* parent)
         : FilterInstance(parent)
     {
@@ -82,23 +87,55 @@ namespace SparkyStudios::Audio::Amplitude
         m_parameters[WaveShaperFilter::ATTRIBUTE_AMOUNT] = parent->_amount;
     }
 
-    AmAudioSample WaveShaperFilterInstance::ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate)
+    void WaveShaperFilterInstance::Process(
+        AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate)
     {
-        AmReal32 k;
-        if (std::abs(m_parameters[WaveShaperFilter::ATTRIBUTE_AMOUNT] - 1.0f) < kEpsilon)
-            k = 2 * m_parameters[WaveShaperFilter::ATTRIBUTE_AMOUNT] / 0.01f;
-        else
-            k = 2 * m_parameters[WaveShaperFilter::ATTRIBUTE_AMOUNT] / (1 - m_parameters[WaveShaperFilter::ATTRIBUTE_AMOUNT]);
+        UpdateParameters();
+
+        if (buffer == nullptr)
+            return;
+
+        AmReal32 wetStep, amountStep;
+        AmReal32 wet = GetParameterRamp(WaveShaperFilter::ATTRIBUTE_WET, frames, wetStep);
+        AmReal32 amount = GetParameterRamp(WaveShaperFilter::ATTRIBUTE_AMOUNT, frames, amountStep);
+        AmReal32 k = GetShapingFactor(amount);
+
+        // The shaping curve has no state, so all the channels are processed at once.
+        const AmSize length = frames * channels;
+        AmSize i = 0;
+
+#if defined(AM_SIMD_INTRINSICS)
+        // Blocks with ramping parameters only happen after a parameter change, they use the scalar loop.
+        const AmSize end = wetStep == 0.0f && amountStep == 0.0f ? AmAudioFrame::size * (length / AmAudioFrame::size) : 0;
+
+        const AmAudioFrame one(1.0f), bk(k), bk1(1.0f + k), bw(wet);
+
+        for (; i < end; i += AmAudioFrame::size)
+        {
+            const auto x = AmAudioFrame::load_unaligned(&buffer[i]);
+            const auto y = x * ((bk1 * x) / xsimd::fma(xsimd::abs(x), bk, one));
+
+            xsimd::fma(y - x, bw, x).store_unaligned(&buffer[i]);
+        }
+#endif // AM_SIMD_INTRINSICS
 
-        const AmReal32 x = sample;
-        /* */ AmReal32 y;
+        // The wet level and the amount ramp per sample, the block being interleaved.
+        wetStep /= static_cast<AmReal32>(channels);
+        amountStep /= static_cast<AmReal32>(channels);
 
-        const AmReal32 p = std::abs(x) * k + 1.0f;
-        const AmReal32 q = (1.0f + k) * x;
+        for (; i < length; ++i)
+        {
+            const AmReal32 x = buffer[i];
+            const AmReal32 y = x * ((1.0f + k) * x / (std::abs(x) * k + 1.0f));
 
-        y = x * (q / p);
-        y = x + (y - x) * m_parameters[WaveShaperFilter::ATTRIBUTE_WET];
+            buffer[i] = static_cast<AmAudioSample>(x + (y - x) * wet);
+            wet += wetStep;
 
-        return static_cast<AmAudioSample>(y);
+            if (amountStep != 0.0f)
+            {
+                amount += amountStep;
+                k = GetShapingFactor(amount);
+            }
+        }
     }
 } // namespace SparkyStudios::Audio::Amplitude
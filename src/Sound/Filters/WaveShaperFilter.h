@@ -29,7 +29,8 @@ namespace SparkyStudios::Audio::Amplitude
         explicit WaveShaperFilterInstance(WaveShaperFilter* parent);
         ~WaveShaperFilterInstance() override = default;
 
-        AmAudioSample ProcessSample(AmAudioSample sample, AmUInt16 channel, AmUInt32 sampleRate) override;
+        void Process(
+            AmAudioSampleBuffer buffer, AmUInt64 frames, AmUInt64 bufferSize, AmUInt16 channels, AmUInt32 sampleRate) override;
     };
 
     [[maybe_unused]] static class WaveShaperFilter final : public Filter
@@ -23,25 +23,152 @@ namespace SparkyStudios::Audio::Amplitude
 {
     static AmObjectID gLastSoundInstanceID = 0;
 
+    class DecodeSoundDataTask final : public Thread::PoolTask
+    {
+    public:
+        explicit DecodeSoundDataTask(Sound* sound)
+            : PoolTask()
+            , _sound(sound)
+        {}
+
+        void Work() override
+        {
+            const AmUInt64 frames = _sound->_format.GetFramesCount();
+            const bool success = _sound->_soundData->sampleFormat == AM_SAMPLE_FORMAT_INT
+                ? DecodeInt16(frames)
+                : _sound->_decoder->Load(reinterpret_cast<AmAudioSampleBuffer>(_sound->_soundData->buffer)) == frames;
+
+            if (!success)
+                CallLogFunc("[ERROR] Unable to decode the sound data of '" AM_OS_CHAR_FMT "'.\n", _sound->GetPath().c_str());
+
+            _sound->_soundDataState.store(success ? SoundDataState::Loaded : SoundDataState::Failed, std::memory_order_release);
+
+            // Drop the reference held while decoding.
+            _sound->ReleaseSoundData();
+        }
+
+        bool Ready() override
+        {
+            return _sound != nullptr;
+        }
+
+    private:
+        // Decoders output float samples, so the sound is decoded by blocks which are narrowed
+        // to 16-bit samples, instead of decoding the whole file into a float buffer first.
+        bool DecodeInt16(AmUInt64 frames) const
+        {
+            const AmUInt16 channels = _sound->_format.GetNumChannels();
+
+            const AmSize blockSize = kDecodeBlockFrames * channels * sizeof(AmAudioSample);
+
+            auto* block = static_cast<AmAudioSampleBuffer>(ampoolmalloc(MemoryPoolKind::Codec, blockSize));
+            if (block == nullptr)
+                return false;
+
+            auto* out = reinterpret_cast<AmInt16Buffer>(_sound->_soundData->buffer);
+
+            if (_sound->_decoder->GetCursor() != 0 && !_sound->_decoder->Seek(0))
+            {
+                ampoolfree(MemoryPoolKind::Codec, block);
+                return false;
+            }
+
+            AmUInt64 offset = 0;
+            while (offset < frames)
+            {
+                const AmUInt64 length = AM_MIN(kDecodeBlockFrames, frames - offset);
+
+                if (_sound->_decoder->StreamNext(block, length) != length)
+                    break;
+
+                ConvertReal32ToInt16(out + offset * channels, block, length * channels);
+                offset += length;
+            }
+
+            ampoolfree(MemoryPoolKind::Codec, block);
+
+            return offset == frames;
+        }
+
+        static constexpr AmUInt64 kDecodeBlockFrames = 4096;
+
+        Sound* _sound = nullptr;
+    };
+
+    class OpenSoundSourceTask final : public Thread::PoolTask
+    {
+    public:
+        explicit OpenSoundSourceTask(Sound* sound, const FileSystem* loader)
+            : PoolTask()
+            , _sound(sound)
+            , _loader(loader)
+        {}
+
+        void Work() override
+        {
+            _sound->Load(_loader);
+
+            // Notify under the lock, the sound may be destroyed as soon as it's released.
+            std::lock_guard lock(_sound->_loadMutex);
+            _sound->_loadPending = false;
+            _sound->_loadCondition.notify_all();
+        }
+
+        bool Ready() override
+        {
+            return _sound != nullptr;
+        }
+
+    private:
+        Sound* _sound = nullptr;
+        const FileSystem* _loader = nullptr;
+    };
+
     Sound::Sound()
         : SoundObject()
         , _codec(nullptr)
         , _decoder(nullptr)
         , _stream(false)
+        , _keepCompressed(false)
+        , _compressedData(nullptr)
         , _loop(false)
         , _loopCount(0)
         , _settings()
         , _soundData(nullptr)
         , _format()
         , _soundDataRefCounter()
+        , _soundDataMutex(Thread::CreateMutex())
+        , _soundDataState(SoundDataState::Unloaded)
+        , _cachePinned(false)
+        , _streamPrefetchDuration(0)
+        , _streamPrefetchData(nullptr)
+        , _streamPrefetchFrames(0)
+        , _loaded(false)
+        , _loadPending(false)
+        , _loadMutex()
+        , _loadCondition()
     {}
 
     Sound::~Sound()
     {
+        // Wait for a pending background opening of the audio file.
+        {
+            std::unique_lock lock(_loadMutex);
+            _loadCondition.wait(
+                lock,
+                [this]
+                {
+                    return !_loadPending;
+                });
+        }
+
+        // Wait for a pending background decoding to complete before closing the decoder.
+        while (_soundDataState.load(std::memory_order_acquire) == SoundDataState::Loading)
+            Thread::Sleep(1);
+
         if (_decoder != nullptr)
         {
-            _decoder->Close();
-            _codec->DestroyDecoder(_decoder);
+            _codec->ReleaseDecoder(_decoder);
 
             _decoder = nullptr;
             _codec = nullptr;
@@ -55,6 +182,19 @@ namespace SparkyStudios::Audio::Amplitude
             _soundData = nullptr;
         }
 
+        if (const auto* state = amEngine->GetState(); state != nullptr)
+            state->sound_data_cache.Erase(_id);
+
+        if (_streamPrefetchData != nullptr)
+        {
+            SoundChunk::DestroyChunk(_streamPrefetchData);
+            _streamPrefetchData = nullptr;
+            _streamPrefetchFrames = 0;
+        }
+
+        Thread::DestroyMutex(_soundDataMutex);
+        _soundDataMutex = nullptr;
+
         m_bus = nullptr;
         m_effect = nullptr;
         m_attenuation = nullptr;
@@ -81,23 +221,56 @@ namespace SparkyStudios::Audio::Amplitude
 
     SoundChunk* Sound::AcquireSoundData()
     {
-        if (_stream)
+        if (_stream || _decoder == nullptr)
             return nullptr;
 
+        bool decode = false;
+
+        Thread::LockMutex(_soundDataMutex);
+
         if (_soundDataRefCounter.GetCount() == 0)
         {
-            _soundData = SoundChunk::CreateChunk(_format.GetFramesCount(), _format.GetNumChannels());
+            // Reuse the decoded data kept by the cache since the last time this sound played.
+            _soundData = amEngine->GetState()->sound_data_cache.Acquire(_id);
 
-            if (_decoder->Load(reinterpret_cast<AmAudioSampleBuffer>(_soundData->buffer)) != _format.GetFramesCount())
+            if (_soundData != nullptr)
             {
-                SoundChunk::DestroyChunk(_soundData);
-                CallLogFunc("Could not load a sound instance. Unable to read data from the parent sound.\n");
-                return nullptr;
+                _soundDataState.store(SoundDataState::Loaded, std::memory_order_release);
+            }
+            else
+            {
+                // Integer PCM sources with up to 16 bits per sample are kept as 16-bit samples, which halves their memory footprint.
+                // Lossy and compressed formats decode to float samples, whatever bit depth they report.
+                const AmUInt32 bitsPerSample = _format.GetBitsPerSample();
+                const AM_SAMPLE_FORMAT sampleFormat = _decoder->HasIntegerSamples() && bitsPerSample > 0 && bitsPerSample <= 16
+                    ? AM_SAMPLE_FORMAT_INT
+                    : AM_SAMPLE_FORMAT_FLOAT;
+
+                _soundData =
+                    SoundChunk::CreateChunk(_format.GetFramesCount(), _format.GetNumChannels(), MemoryPoolKind::SoundData, sampleFormat);
+                _soundDataState.store(SoundDataState::Loading, std::memory_order_release);
+
+                // The decoding task holds its own reference until it completes.
+                _soundDataRefCounter.Increment();
+                decode = true;
             }
         }
 
         _soundDataRefCounter.Increment();
-        return _soundData;
+        SoundChunk* chunk = _soundData;
+
+        Thread::UnlockMutex(_soundDataMutex);
+
+        if (decode)
+        {
+            auto task = std::shared_ptr<DecodeSoundDataTask>(
+                ampoolnew(MemoryPoolKind::Engine, DecodeSoundDataTask, this), am_delete<MemoryPoolKind::Engine, DecodeSoundDataTask>{});
+
+            // Without loader threads, the task is executed right away on the calling thread.
+            amEngine->GetState()->sound_data_loader.AddTask(task);
+        }
+
+        return chunk;
     }
 
     void Sound::ReleaseSoundData()
@@ -105,13 +278,29 @@ namespace SparkyStudios::Audio::Amplitude
         if (_stream)
             return;
 
-        _soundDataRefCounter.Decrement();
+        Thread::LockMutex(_soundDataMutex);
 
-        if (_soundDataRefCounter.GetCount() == 0)
+        if (_soundDataRefCounter.Decrement() == 0)
         {
-            SoundChunk::DestroyChunk(_soundData);
+            // Only keep fully decoded data in the cache.
+            if (_soundDataState.load(std::memory_order_acquire) == SoundDataState::Loaded)
+                amEngine->GetState()->sound_data_cache.Release(_id, _soundData, _cachePinned);
+            else
+                SoundChunk::DestroyChunk(_soundData);
+
             _soundData = nullptr;
+            _soundDataState.store(SoundDataState::Unloaded, std::memory_order_release);
         }
+
+        Thread::UnlockMutex(_soundDataMutex);
+    }
+
+    SoundDataState Sound::GetSoundDataState() const
+    {
+        if (_stream)
+            return SoundDataState::Loaded;
+
+        return _soundDataState.load(std::memory_order_acquire);
     }
 
     bool Sound::IsStream() const
@@ -124,7 +313,49 @@ namespace SparkyStudios::Audio::Amplitude
         return _loop;
     }
 
+    bool Sound::IsLoaded() const
+    {
+        return _loaded.load(std::memory_order_acquire);
+    }
+
     void Sound::Load(const FileSystem* loader)
+    {
+        if (_loaded.load(std::memory_order_acquire))
+            return;
+
+        Thread::LockMutex(_soundDataMutex);
+
+        // The sound may be shared by several sound banks, or loaded on its first play from another thread.
+        if (!_loaded.load(std::memory_order_relaxed))
+        {
+            OpenSource(loader);
+            _loaded.store(true, std::memory_order_release);
+        }
+
+        Thread::UnlockMutex(_soundDataMutex);
+    }
+
+    void Sound::LoadAsync(const FileSystem* loader)
+    {
+        if (_loaded.load(std::memory_order_acquire))
+            return;
+
+        {
+            std::lock_guard lock(_loadMutex);
+            if (_loadPending)
+                return;
+
+            _loadPending = true;
+        }
+
+        auto task = std::shared_ptr<OpenSoundSourceTask>(
+            ampoolnew(MemoryPoolKind::Engine, OpenSoundSourceTask, this, loader), am_delete<MemoryPoolKind::Engine, OpenSoundSourceTask>{});
+
+        // Without loader threads, the task is executed right away on the calling thread.
+        amEngine->GetState()->sound_data_loader.AddTask(task);
+    }
+
+    void Sound::OpenSource(const FileSystem* loader)
     {
         const AmOsString& filename = GetPath();
 
@@ -149,14 +380,51 @@ namespace SparkyStudios::Audio::Amplitude
             return;
         }
 
-        _decoder = _codec->CreateDecoder();
-        if (!_decoder->Open(file))
+        std::shared_ptr<File> source = file;
+
+        if (_keepCompressed)
+        {
+            // Keep the encoded file in memory, the mixer will decode it on the fly.
+            const auto memory = std::make_shared<MemoryFile>();
+            if (memory->OpenFileToMem(file.get()) != AM_ERROR_NO_ERROR)
+            {
+                CallLogFunc("[ERROR] Cannot load the sound: unable to read '" AM_OS_CHAR_FMT "' into memory.\n", filename.c_str());
+                return;
+            }
+
+            memory->Seek(0, SEEK_SET);
+            source = memory;
+            _compressedData = memory;
+        }
+
+        _decoder = _codec->AcquireDecoder();
+        if (!_decoder->Reset(source))
         {
             CallLogFunc("[ERROR] Cannot load the sound: unable to initialize a decoder for '" AM_OS_CHAR_FMT "'.\n", filename.c_str());
             return;
         }
 
         _format = _decoder->GetFormat();
+
+        if (_stream && _streamPrefetchDuration > 0)
+        {
+            // Decode the head of the stream now, so the first buffers never wait on the decoder.
+            const AmUInt64 frames =
+                AM_MIN(_format.GetFramesCount(), static_cast<AmUInt64>(_format.GetSampleRate()) * _streamPrefetchDuration / 1000);
+
+            _streamPrefetchData = SoundChunk::CreateChunk(frames, _format.GetNumChannels());
+            if (_streamPrefetchData == nullptr)
+                return;
+
+            _streamPrefetchFrames = _decoder->Stream(reinterpret_cast<AmAudioSampleBuffer>(_streamPrefetchData->buffer), 0, frames);
+            if (_streamPrefetchFrames == 0)
+            {
+                CallLogFunc("[WARNING] Unable to prefetch the stream head of '" AM_OS_CHAR_FMT "'.\n", filename.c_str());
+
+                SoundChunk::DestroyChunk(_streamPrefetchData);
+                _streamPrefetchData = nullptr;
+            }
+        }
     }
 
     bool Sound::LoadDefinition(const SoundDefinition* definition, EngineInternalState* state)
@@ -212,6 +480,12 @@ namespace SparkyStudios::Audio::Amplitude
         auto* fs = amEngine->GetFileSystem();
 
         _stream = definition->stream();
+        _streamPrefetchDuration = _stream ? definition->stream_prefetch() : 0;
+
+        // Compressed sounds are played like streams, but read from memory instead of the disk.
+        _keepCompressed = !_stream && definition->keep_compressed();
+        _stream = _stream || _keepCompressed;
+        _cachePinned = !_stream && definition->cache_pinned();
         _loop = definition->loop() != nullptr && definition->loop()->enabled();
         _loopCount = definition->loop() ? definition->loop()->loop_count() : 0;
         _filename = fs->ResolvePath(fs->Join({ AM_OS_STRING("data"), AM_STRING_TO_OS_STRING(definition->path()->str()) }));
@@ -267,6 +541,7 @@ namespace SparkyStudios::Audio::Amplitude
         , _channel(nullptr)
         , _parent(parent)
         , _collection(nullptr)
+        , _decoder(nullptr)
         , _effect(effect)
         , _effectInstance()
         , _settings(std::move(settings))
@@ -274,6 +549,8 @@ namespace SparkyStudios::Audio::Amplitude
         , _obstruction(0.0f)
         , _occlusion(0.0f)
         , _id(++gLastSoundInstanceID)
+        , _loadTime(0)
+        , _processorStates()
     {
         if (_effect != nullptr)
             _effectInstance = _effect->CreateInstance();
@@ -284,13 +561,33 @@ namespace SparkyStudios::Audio::Amplitude
         Destroy();
     }
 
+    bool SoundInstance::LoadAsync()
+    {
+        AMPLITUDE_ASSERT(Valid());
+
+        _parent->LoadAsync(amEngine->GetFileSystem());
+        return _parent->IsLoaded();
+    }
+
     void SoundInstance::Load()
     {
         AMPLITUDE_ASSERT(Valid());
 
+        // Sounds from sound banks using the LoadOnFirstUse load policy are loaded on their first play.
+        _parent->Load(amEngine->GetFileSystem());
+
+        if (_parent->_decoder == nullptr)
+        {
+            CallLogFunc("Could not load a sound instance. The parent sound has no audio file loaded.\n");
+            return;
+        }
+
         const AmUInt16 channels = _parent->_format.GetNumChannels();
         const AmUInt64 frames = _parent->_format.GetFramesCount();
 
+        if (_parent->_keepCompressed && !OpenCompressedData())
+            return;
+
         SoundData* data;
         SoundChunk* chunk;
 
@@ -302,9 +599,14 @@ namespace SparkyStudios::Audio::Amplitude
         else
         {
             chunk = _parent->AcquireSoundData();
-            data = SoundData::CreateSound(_parent->_format, chunk, frames, this);
+
+            // The mixer waits for the sound data to be decoded, unless the decoding has already failed.
+            data = _parent->GetSoundDataState() == SoundDataState::Failed ? nullptr
+                                                                          : SoundData::CreateSound(_parent->_format, chunk, frames, this);
         }
 
+        _loadTime = Thread::GetTimeMillis();
+
         if (data == nullptr)
         {
             CallLogFunc("Could not load a sound instance. Unable to read data from the parent sound.\n");
@@ -323,6 +625,32 @@ namespace SparkyStudios::Audio::Amplitude
         SetUserData(data);
     }
 
+    bool SoundInstance::OpenCompressedData()
+    {
+        if (_decoder != nullptr)
+            return true;
+
+        // Each instance reads the compressed data from its own position.
+        const auto file = std::make_shared<MemoryFile>();
+        if (_parent->_compressedData == nullptr || file->OpenShared(*_parent->_compressedData) != AM_ERROR_NO_ERROR)
+        {
+            CallLogFunc("Could not load a sound instance. The parent sound has no compressed data.\n");
+            return false;
+        }
+
+        _decoder = _parent->_codec->AcquireDecoder();
+        if (!_decoder->Reset(file))
+        {
+            CallLogFunc("Could not load a sound instance. Unable to initialize a decoder for the compressed data.\n");
+
+            _parent->_codec->ReleaseDecoder(_decoder);
+            _decoder = nullptr;
+            return false;
+        }
+
+        return true;
+    }
+
     const SoundInstanceSettings& SoundInstance::GetSettings() const
     {
         return _settings;
@@ -348,6 +676,7 @@ namespace SparkyStudios::Audio::Amplitude
         const auto* data = static_cast<SoundData*>(_userData);
 
         const AmUInt16 channels = _parent->_format.GetNumChannels();
+        Codec::Decoder* decoder = _decoder != nullptr ? _decoder : _parent->_decoder;
 
         AmUInt64 l = frames, o = offset, r = 0;
         auto b = reinterpret_cast<AmAudioSampleBuffer>(data->chunk->buffer);
@@ -355,12 +684,28 @@ namespace SparkyStudios::Audio::Amplitude
         bool needFill = true;
         do
         {
-            const AmUInt64 n = _parent->_decoder->Stream(b, o, l);
+            AmUInt64 n = 0;
+
+            // Serve the part of the request covered by the prefetched head from memory.
+            if (o < _parent->_streamPrefetchFrames)
+            {
+                n = AM_MIN(l, _parent->_streamPrefetchFrames - o);
+
+                std::memcpy(
+                    b, reinterpret_cast<AmAudioSampleBuffer>(_parent->_streamPrefetchData->buffer) + o * channels,
+                    n * channels * sizeof(AmAudioSample));
+            }
+
+            // Past the head, the stream is read synchronously. It is not refilled in the background, since
+            // all the instances of a sound streamed from the disk share the same decoder.
+            if (n < l)
+                n += decoder->Stream(b + n * channels, o + n, l - n);
+
             r += n;
 
             // If we reached the end of the file but looping is enabled, then
             // seek back to the beginning of the file and fill the remaining part of the buffer.
-            if (needFill = n < l && _parent->_loop && _parent->_decoder->Seek(0); needFill)
+            if (needFill = n < l && _parent->_loop && decoder->Seek(0); needFill)
             {
                 b += n * channels;
                 l -= n;
@@ -385,6 +730,19 @@ namespace SparkyStudios::Audio::Amplitude
 
         _userData = nullptr;
 
+        if (_decoder != nullptr)
+        {
+            _parent->_codec->ReleaseDecoder(_decoder);
+            _decoder = nullptr;
+        }
+
+        // Release the states the processors allocated for this instance, whichever way it has been stopped.
+        if (auto* state = amEngine->GetState(); state != nullptr)
+        {
+            if (ProcessorPipeline* pipeline = state->mixer.GetPipeline(); pipeline != nullptr)
+                pipeline->Cleanup(this);
+        }
+
         _effect->DestroyInstance(_effectInstance);
         _effectInstance = nullptr;
 
@@ -450,4 +808,20 @@ namespace SparkyStudios::Audio::Amplitude
     {
         return _id;
     }
+
+    AmVoidPtr SoundInstance::GetProcessorState(AmUInt32 slot) const
+    {
+        if (slot >= AM_MAX_SOUND_PROCESSOR_STATES)
+            return nullptr;
+
+        return _processorStates[slot];
+    }
+
+    void SoundInstance::SetProcessorState(AmUInt32 slot, AmVoidPtr state)
+    {
+        if (slot >= AM_MAX_SOUND_PROCESSOR_STATES)
+            return;
+
+        _processorStates[slot] = state;
+    }
 } // namespace SparkyStudios::Audio::Amplitude
@@ -12,6 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
 #include <SparkyStudios/Audio/Amplitude/Core/Log.h>
 #include <SparkyStudios/Audio/Amplitude/Sound/SoundBank.h>
 
@@ -34,6 +39,8 @@ namespace SparkyStudios::Audio::Amplitude
         , _soundBankDefSource()
         , _name()
         , _id(kAmInvalidObjectId)
+        , _pendingSoundsToLoad()
+        , _preloadedSounds()
     {}
 
     SoundBank::SoundBank(const std::string& source)
@@ -47,321 +54,263 @@ namespace SparkyStudios::Audio::Amplitude
         _name = definition->name()->str();
     }
 
-    static bool InitializeSwitchContainer(const AmOsString& filename, const Engine* engine)
-    {
-        // Find the ID.
-        SwitchContainerHandle handle = engine->GetSwitchContainerHandleFromFile(filename);
-        if (handle)
-        {
-            // We've seen this ID before, update it.
-            handle->GetRefCounter()->Increment();
-        }
-        else
-        {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("switch_containers"), filename }));
-
-            // This is a new switch container, load it and update it.
-            AmUniquePtr<MemoryPoolKind::Engine, SwitchContainer> switch_container(ampoolnew(MemoryPoolKind::Engine, SwitchContainer));
-            if (!switch_container->LoadDefinitionFromPath(filePath, engine->GetState()))
-                return false;
-
-            const SwitchContainerDefinition* definition = switch_container->GetDefinition();
-            const AmSwitchContainerID id = definition->id();
-            if (id == kAmInvalidObjectId)
-            {
-                CallLogFunc(
-                    "[ERROR] Cannot load switch container \'" AM_OS_CHAR_FMT "\'. Invalid ID.\n",
-                    AM_STRING_TO_OS_STRING(definition->name()->c_str()));
-                return false;
-            }
+    typedef flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> DefinitionFileList;
 
-            switch_container->AcquireReferences(engine->GetState());
-            switch_container->GetRefCounter()->Increment();
+    /**
+     * @brief Shared state of the parallel loading of a list of definition files.
+     */
+    struct DefinitionLoadingBatch
+    {
+        const DefinitionFileList* files = nullptr;
+        flatbuffers::uoffset_t count = 0;
+        std::function<bool(flatbuffers::uoffset_t index, const AmOsString& filename)> initialize;
 
-            engine->GetState()->switch_container_map[id] = std::move(switch_container);
-            engine->GetState()->switch_container_id_map[filename] = id;
-        }
+        std::atomic<flatbuffers::uoffset_t> next = 0;
+        std::atomic<flatbuffers::uoffset_t> done = 0;
+        std::atomic<bool> success = true;
 
-        return true;
-    }
+        std::mutex mutex;
+        std::condition_variable finished;
 
-    static bool InitializeCollection(const AmOsString& filename, const Engine* engine)
-    {
-        // Find the ID.
-        CollectionHandle handle = engine->GetCollectionHandleFromFile(filename);
-        if (handle)
-        {
-            // We've seen this ID before, update it.
-            handle->GetRefCounter()->Increment();
-        }
-        else
+        // Loads definition files until all of them have been picked by a worker.
+        void Run()
         {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("collections"), filename }));
-
-            // This is a new collection, load it and update it.
-            AmUniquePtr<MemoryPoolKind::Engine, Collection> collection(ampoolnew(MemoryPoolKind::Engine, Collection));
-            if (!collection->LoadDefinitionFromPath(filePath, engine->GetState()))
-                return false;
-
-            const CollectionDefinition* definition = collection->GetDefinition();
-            const AmCollectionID id = definition->id();
-            if (id == kAmInvalidObjectId)
+            for (flatbuffers::uoffset_t i = next++; i < count; i = next++)
             {
-                CallLogFunc(
-                    "[ERROR] Cannot load collection \'" AM_OS_CHAR_FMT "\'. Invalid ID.\n",
-                    AM_STRING_TO_OS_STRING(definition->name()->c_str()));
-                return false;
+                // Skip the remaining files once one failed, like the sequential loading does.
+                if (success.load(std::memory_order_relaxed) && !initialize(i, AM_STRING_TO_OS_STRING(files->Get(i)->str())))
+                    success.store(false, std::memory_order_relaxed);
+
+                // Notify under the lock, so the waiting thread can't miss the last file.
+                if (done.fetch_add(1, std::memory_order_acq_rel) + 1 == count)
+                {
+                    std::lock_guard lock(mutex);
+                    finished.notify_all();
+                }
             }
-
-            collection->AcquireReferences(engine->GetState());
-            collection->GetRefCounter()->Increment();
-
-            engine->GetState()->collection_map[id] = std::move(collection);
-            engine->GetState()->collection_id_map[filename] = id;
         }
 
-        return true;
-    }
-
-    static bool InitializeSound(const AmOsString& filename, const Engine* engine, AmSoundID& outId)
-    {
-        // Find the ID
-        SoundHandle handle = engine->GetSoundHandleFromFile(filename);
-        if (handle)
+        // Waits until all the files have been loaded.
+        void Wait()
         {
-            // We've seen this id before, update it
-            handle->GetRefCounter()->Increment();
+            std::unique_lock lock(mutex);
+            finished.wait(
+                lock,
+                [this]
+                {
+                    return done.load(std::memory_order_acquire) == count;
+                });
         }
-        else
-        {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("sounds"), filename }));
+    };
 
-            // This is a new sound, load it and update it.
-            AmUniquePtr<MemoryPoolKind::Engine, Sound> sound(ampoolnew(MemoryPoolKind::Engine, Sound));
-            if (!sound->LoadDefinitionFromPath(filePath, engine->GetState()))
-                return false;
+    class LoadDefinitionsTask final : public Thread::PoolTask
+    {
+    public:
+        explicit LoadDefinitionsTask(std::shared_ptr<DefinitionLoadingBatch> batch)
+            : PoolTask()
+            , _batch(std::move(batch))
+        {}
+
+        void Work() override
+        {
+            _batch->Run();
+        }
+
+    private:
+        std::shared_ptr<DefinitionLoadingBatch> _batch;
+    };
+
+    /**
+     * @brief Loads all the given definition files, spreading the work between the calling thread
+     * and the sound data loader pool.
+     *
+     * @param files The definition files to load.
+     * @param engine The engine instance.
+     * @param initialize The function loading a single definition file.
+     *
+     * @return Whether all the definition files were successfully loaded.
+     */
+    static bool InitializeDefinitions(
+        const DefinitionFileList* files,
+        const Engine* engine,
+        std::function<bool(flatbuffers::uoffset_t index, const AmOsString& filename)> initialize)
+    {
+        if (files == nullptr || files->size() == 0)
+            return true;
 
-            const SoundDefinition* definition = sound->GetDefinition();
-            const AmSoundID id = definition->id();
-            if (id == kAmInvalidObjectId)
-            {
-                CallLogFunc(
-                    "[ERROR] Cannot load sound \'" AM_OS_CHAR_FMT "'. Invalid ID.\n", AM_STRING_TO_OS_STRING(definition->name()->c_str()));
-                return false;
-            }
+        const auto batch = std::make_shared<DefinitionLoadingBatch>();
+        batch->files = files;
+        batch->count = files->size();
+        batch->initialize = std::move(initialize);
 
-            sound->AcquireReferences(engine->GetState());
-            sound->GetRefCounter()->Increment();
+        Thread::Pool& pool = engine->GetState()->sound_data_loader;
 
-            engine->GetState()->sound_map[id] = std::move(sound);
-            engine->GetState()->sound_id_map[filename] = id;
+        const AmUInt32 helpers = AM_MIN(pool.GetThreadCount(), files->size() - 1);
+        for (AmUInt32 i = 0; i < helpers; ++i)
+        {
+            auto task = std::shared_ptr<LoadDefinitionsTask>(
+                ampoolnew(MemoryPoolKind::Engine, LoadDefinitionsTask, batch), am_delete<MemoryPoolKind::Engine, LoadDefinitionsTask>{});
 
-            outId = id;
+            pool.AddTask(task);
         }
 
-        return true;
+        batch->Run();
+
+        // Wait for the files picked by the pool workers.
+        batch->Wait();
+
+        return batch->success;
     }
 
-    static bool InitializeEvent(const AmOsString& filename, const Engine* engine)
+    /**
+     * @brief Loads the definition file of an asset, or references the already loaded asset.
+     *
+     * Definition files of the same kind can be loaded concurrently. The file is read into memory without
+     * holding the engine-wide asset maps lock. The definition is then parsed with the lock held, since
+     * parsing looks up other assets in the engine maps.
+     *
+     * @param filename The name of the definition file.
+     * @param directory The directory of the definition file, relative to the project root.
+     * @param kind The kind of asset, for logging purposes.
+     * @param map The engine map holding the assets.
+     * @param idMap The engine map holding the asset IDs by filename.
+     * @param engine The engine instance.
+     * @param outId The ID of the asset, only set when it has been loaded by this call.
+     *
+     * @return Whether the asset was successfully loaded.
+     */
+    template<typename T, typename Map, typename IdMap>
+    static bool InitializeAsset(
+        const AmOsString& filename,
+        const AmOsChar* directory,
+        const char* kind,
+        Map& map,
+        IdMap& idMap,
+        const Engine* engine,
+        typename Map::key_type& outId)
     {
-        // Find the ID.
-        EventHandle handle = engine->GetEventHandleFromFile(filename);
-        if (handle)
-        {
-            // We've seen this ID before, update it.
-            handle->GetRefCounter()->Increment();
-        }
-        else
-        {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("events"), filename }));
+        AmMutexHandle mutex = engine->GetState()->asset_maps_mutex;
 
-            // This is a new event, load it and update it.
-            AmUniquePtr<MemoryPoolKind::Engine, Event> event(ampoolnew(MemoryPoolKind::Engine, Event));
-            if (!event->LoadDefinitionFromPath(filePath, engine->GetState()))
+        // Increments the reference counter of the asset if it's already loaded. Must be called with the lock held.
+        const auto reference = [&]() -> bool
+        {
+            const auto idIt = idMap.find(filename);
+            if (idIt == idMap.end())
                 return false;
 
-            const EventDefinition* definition = event->GetDefinition();
-            const AmEventID id = definition->id();
-            if (id == kAmInvalidObjectId)
-            {
-                CallLogFunc(
-                    "[ERROR] Cannot load event \'" AM_OS_CHAR_FMT "\'. Invalid ID.\n", AM_STRING_TO_OS_STRING(definition->name()->c_str()));
+            const auto it = map.find(idIt->second);
+            if (it == map.end())
                 return false;
-            }
-
-            event->AcquireReferences(engine->GetState());
-            event->GetRefCounter()->Increment();
-
-            engine->GetState()->event_map[id] = std::move(event);
-            engine->GetState()->event_id_map[filename] = id;
-        }
-
-        return true;
-    }
 
-    static bool InitializeAttenuation(const AmOsString& filename, const Engine* engine)
-    {
-        // Find the ID.
-        AttenuationHandle handle = engine->GetAttenuationHandleFromFile(filename);
-        if (handle)
-        {
             // We've seen this ID before, update it.
-            handle->GetRefCounter()->Increment();
-        }
-        else
-        {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("attenuators"), filename }));
+            it->second->GetRefCounter()->Increment();
 
-            // This is a new event, load it and update it.
-            AmUniquePtr<MemoryPoolKind::Engine, Attenuation> attenuation(ampoolnew(MemoryPoolKind::Engine, Attenuation));
-            if (!attenuation->LoadDefinitionFromPath(filePath, engine->GetState()))
-                return false;
+            return true;
+        };
 
-            const AttenuationDefinition* definition = attenuation->GetDefinition();
-            const AmAttenuationID id = definition->id();
-            if (id == kAmInvalidObjectId)
-            {
-                CallLogFunc(
-                    "[ERROR] Cannot load attenuation \'" AM_OS_CHAR_FMT "\'. Invalid ID.\n",
-                    AM_STRING_TO_OS_STRING(definition->name()->c_str()));
-                return false;
-            }
+        Thread::LockMutex(mutex);
+        const bool loaded = reference();
+        Thread::UnlockMutex(mutex);
 
-            attenuation->AcquireReferences(engine->GetState());
-            attenuation->GetRefCounter()->Increment();
+        if (loaded)
+            return true;
 
-            engine->GetState()->attenuation_map[id] = std::move(attenuation);
-            engine->GetState()->attenuation_id_map[filename] = id;
-        }
-
-        return true;
-    }
+        const FileSystem* fs = engine->GetFileSystem();
+        const AmOsString& filePath = fs->ResolvePath(fs->Join({ directory, filename }));
 
-    static bool InitializeSwitch(const AmOsString& filename, const Engine* engine)
-    {
-        // Find the ID.
-        SwitchHandle handle = engine->GetSwitchHandleFromFile(filename);
-        if (handle)
+        // Read the file outside the lock, this is where loading spends most of its time.
+        const std::shared_ptr<File> file = fs->OpenFile(filePath);
+        if (!file->IsValid())
         {
-            // We've seen this ID before, update it.
-            handle->GetRefCounter()->Increment();
+            CallLogFunc("[ERROR] Cannot load %s \'" AM_OS_CHAR_FMT "\'. The file is not valid.\n", kind, filename.c_str());
+            return false;
         }
-        else
-        {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("switches"), filename }));
 
-            // This is a new event, load it and update it.
-            AmUniquePtr<MemoryPoolKind::Engine, Switch> _switch(ampoolnew(MemoryPoolKind::Engine, Switch));
-            if (!_switch->LoadDefinitionFromPath(filePath, engine->GetState()))
-            {
-                return false;
-            }
-
-            const SwitchDefinition* definition = _switch->GetDefinition();
-            const AmSwitchID id = definition->id();
-            if (id == kAmInvalidObjectId)
-            {
-                CallLogFunc(
-                    "[ERROR] Cannot load switch \'" AM_OS_CHAR_FMT "\'. Invalid ID.\n",
-                    AM_STRING_TO_OS_STRING(definition->name()->c_str()));
-                return false;
-            }
-
-            _switch->AcquireReferences(engine->GetState());
-            _switch->GetRefCounter()->Increment();
-
-            engine->GetState()->switch_map[id] = std::move(_switch);
-            engine->GetState()->switch_id_map[filename] = id;
+        const auto memory = std::make_shared<MemoryFile>();
+        if (memory->OpenFileToMem(file.get()) != AM_ERROR_NO_ERROR)
+        {
+            CallLogFunc("[ERROR] Cannot load %s \'" AM_OS_CHAR_FMT "\'. Unable to read the file.\n", kind, filename.c_str());
+            return false;
         }
 
-        return true;
-    }
+        Thread::LockMutex(mutex);
 
-    static bool InitializeRtpc(const AmOsString& filename, const Engine* engine)
-    {
-        // Find the ID.
-        RtpcHandle handle = engine->GetRtpcHandleFromFile(filename);
-        if (handle)
+        // The same file may have been loaded by another worker in the meantime.
+        if (reference())
         {
-            // We've seen this ID before, update it.
-            handle->GetRefCounter()->Increment();
+            Thread::UnlockMutex(mutex);
+            return true;
         }
-        else
+
+        // This is a new asset, load it and update it.
+        AmUniquePtr<MemoryPoolKind::Engine, T> asset(ampoolnew(MemoryPoolKind::Engine, T));
+        if (!asset->LoadDefinitionFromFile(memory, engine->GetState()))
         {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("rtpc"), filename }));
+            Thread::UnlockMutex(mutex);
+            return false;
+        }
 
-            // This is a new event, load it and update it.
-            AmUniquePtr<MemoryPoolKind::Engine, Rtpc> rtpc(ampoolnew(MemoryPoolKind::Engine, Rtpc));
-            if (!rtpc->LoadDefinitionFromPath(filePath, engine->GetState()))
-            {
-                return false;
-            }
+        const auto* definition = asset->GetDefinition();
+        const auto id = definition->id();
+        if (id == kAmInvalidObjectId)
+        {
+            Thread::UnlockMutex(mutex);
+            CallLogFunc(
+                "[ERROR] Cannot load %s \'" AM_OS_CHAR_FMT "\'. Invalid ID.\n", kind, AM_STRING_TO_OS_STRING(definition->name()->c_str()));
+            return false;
+        }
 
-            const RtpcDefinition* definition = rtpc->GetDefinition();
-            const AmRtpcID id = definition->id();
-            if (id == kAmInvalidObjectId)
-            {
-                CallLogFunc(
-                    "[ERROR] Cannot load RTPC \'" AM_OS_CHAR_FMT "\'. Invalid ID.\n", AM_STRING_TO_OS_STRING(definition->name()->c_str()));
-                return false;
-            }
+        asset->AcquireReferences(engine->GetState());
+        asset->GetRefCounter()->Increment();
 
-            rtpc->AcquireReferences(engine->GetState());
-            rtpc->GetRefCounter()->Increment();
+        map[id] = std::move(asset);
+        idMap[filename] = id;
+        outId = id;
 
-            engine->GetState()->rtpc_map[id] = std::move(rtpc);
-            engine->GetState()->rtpc_id_map[filename] = id;
-        }
+        Thread::UnlockMutex(mutex);
 
         return true;
     }
 
-    static bool InitializeEffect(const AmOsString& filename, const Engine* engine)
+    /**
+     * @brief Loads all the given definition files of the same kind in parallel.
+     *
+     * @param files The definition files to load.
+     * @param directory The directory of the definition files, relative to the project root.
+     * @param kind The kind of asset, for logging purposes.
+     * @param map The engine map holding the assets.
+     * @param idMap The engine map holding the asset IDs by filename.
+     * @param engine The engine instance.
+     * @param outIds If not null, receives the IDs of the assets loaded by this call, in the order of the files.
+     *
+     * @return Whether all the definition files were successfully loaded.
+     */
+    template<typename T, typename Map, typename IdMap>
+    static bool InitializeAssets(
+        const DefinitionFileList* files,
+        const AmOsChar* directory,
+        const char* kind,
+        Map& map,
+        IdMap& idMap,
+        const Engine* engine,
+        std::vector<typename Map::key_type>* outIds = nullptr)
     {
-        // Find the ID.
-        EffectHandle handle = engine->GetEffectHandleFromFile(filename);
-        if (handle)
-        {
-            // We've seen this ID before, update it.
-            handle->GetRefCounter()->Increment();
-        }
-        else
-        {
-            const FileSystem* fs = engine->GetFileSystem();
-            const AmOsString& filePath = fs->ResolvePath(fs->Join({ AM_OS_STRING("effects"), filename }));
+        if (files == nullptr)
+            return true;
 
-            // This is a new event, load it and update it.
-            AmUniquePtr<MemoryPoolKind::Engine, Effect> effect(ampoolnew(MemoryPoolKind::Engine, Effect));
-            if (!effect->LoadDefinitionFromPath(filePath, engine->GetState()))
-            {
-                return false;
-            }
+        std::vector<typename Map::key_type> ids(files->size(), kAmInvalidObjectId);
 
-            const EffectDefinition* definition = effect->GetDefinition();
-            const AmEffectID id = definition->id();
-            if (id == kAmInvalidObjectId)
+        const bool success = InitializeDefinitions(
+            files, engine,
+            [&](flatbuffers::uoffset_t index, const AmOsString& filename)
             {
-                CallLogFunc(
-                    "[ERROR] Cannot load effect \'" AM_OS_CHAR_FMT "\'. Invalid ID.\n",
-                    AM_STRING_TO_OS_STRING(definition->name()->c_str()));
-                return false;
-            }
-
-            effect->AcquireReferences(engine->GetState());
-            effect->GetRefCounter()->Increment();
+                return InitializeAsset<T>(filename, directory, kind, map, idMap, engine, ids[index]);
+            });
 
-            engine->GetState()->effect_map[id] = std::move(effect);
-            engine->GetState()->effect_id_map[filename] = id;
-        }
+        if (outIds != nullptr)
+            *outIds = std::move(ids);
 
-        return true;
+        return success;
     }
 
     bool SoundBank::Initialize(const AmOsString& filename, Engine* engine)
@@ -549,6 +498,14 @@ namespace SparkyStudios::Audio::Amplitude
     {
         const SoundBankDefinition* definition = GetSoundBankDefinition();
 
+        for (const auto& id : _preloadedSounds)
+        {
+            if (const auto it = engine->GetState()->sound_map.find(id); it != engine->GetState()->sound_map.end())
+                it->second->ReleaseSoundData();
+        }
+
+        _preloadedSounds.clear();
+
         for (flatbuffers::uoffset_t i = 0; i < definition->switch_containers()->size(); ++i)
         {
             AmString filename = definition->switch_containers()->Get(i)->c_str();
@@ -652,6 +609,12 @@ namespace SparkyStudios::Audio::Amplitude
 
     void SoundBank::LoadSoundFiles(const Engine* engine)
     {
+        const SoundBankDefinition* definition = GetSoundBankDefinition();
+
+        // Lazily loaded sounds open their file on their first play, so they can't be preloaded.
+        const bool lazy = definition->load_policy() == SoundBankLoadPolicy_LoadOnFirstUse;
+        const bool preload = !lazy && definition->decode_policy() == SoundBankDecodePolicy_PreloadOnLoad;
+
         while (!_pendingSoundsToLoad.empty())
         {
             const auto id = _pendingSoundsToLoad.front();
@@ -660,7 +623,15 @@ namespace SparkyStudios::Audio::Amplitude
             if (!engine->GetState()->sound_map.contains(id))
                 continue;
 
-            engine->GetState()->sound_map[id]->Load(engine->GetFileSystem());
+            if (lazy)
+                continue;
+
+            Sound* sound = engine->GetState()->sound_map[id].get();
+            sound->Load(engine->GetFileSystem());
+
+            // Keep a reference on the sound data until the sound bank is unloaded.
+            if (preload && !sound->IsStream() && sound->AcquireSoundData() != nullptr)
+                _preloadedSounds.push_back(id);
         }
     }
 
@@ -668,67 +639,60 @@ namespace SparkyStudios::Audio::Amplitude
     {
         bool success = true;
         const SoundBankDefinition* definition = GetSoundBankDefinition();
+        EngineInternalState* state = engine->GetState();
 
         _id = definition->id();
         _name = definition->name()->str();
 
+        // Definitions only reference definitions of the kinds loaded before them. Files of the same
+        // kind are loaded in parallel, and each kind waits for the previous one to complete.
+
         // Load each Rtpc named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->rtpc()->size(); ++i)
-        {
-            AmString filename = definition->rtpc()->Get(i)->c_str();
-            success &= InitializeRtpc(AM_STRING_TO_OS_STRING(filename), engine);
-        }
+        success = success &&
+            InitializeAssets<Rtpc>(definition->rtpc(), AM_OS_STRING("rtpc"), "RTPC", state->rtpc_map, state->rtpc_id_map, engine);
 
         // Load each effect named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->effects()->size(); ++i)
-        {
-            AmString filename = definition->effects()->Get(i)->c_str();
-            success &= InitializeEffect(AM_STRING_TO_OS_STRING(filename), engine);
-        }
+        success = success &&
+            InitializeAssets<Effect>(
+                definition->effects(), AM_OS_STRING("effects"), "effect", state->effect_map, state->effect_id_map, engine);
 
         // Load each Switch named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->switches()->size(); ++i)
-        {
-            AmString switch_filename = definition->switches()->Get(i)->c_str();
-            success &= InitializeSwitch(AM_STRING_TO_OS_STRING(switch_filename), engine);
-        }
+        success = success &&
+            InitializeAssets<Switch>(
+                definition->switches(), AM_OS_STRING("switches"), "switch", state->switch_map, state->switch_id_map, engine);
 
         // Load each Attenuation named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->attenuators()->size(); ++i)
-        {
-            AmString attenuation_filename = definition->attenuators()->Get(i)->c_str();
-            success &= InitializeAttenuation(AM_STRING_TO_OS_STRING(attenuation_filename), engine);
-        }
+        success = success &&
+            InitializeAssets<Attenuation>(
+                definition->attenuators(), AM_OS_STRING("attenuators"), "attenuation", state->attenuation_map,
+                state->attenuation_id_map, engine);
 
         // Load each Event named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->events()->size(); ++i)
-        {
-            AmString event_filename = definition->events()->Get(i)->c_str();
-            success &= InitializeEvent(AM_STRING_TO_OS_STRING(event_filename), engine);
-        }
+        success = success &&
+            InitializeAssets<Event>(definition->events(), AM_OS_STRING("events"), "event", state->event_map, state->event_id_map, engine);
 
         // Load each Sound named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->sounds()->size(); ++i)
+        if (success)
         {
-            AmSoundID id = kAmInvalidObjectId;
-            AmString filename = definition->sounds()->Get(i)->c_str();
-            success &= InitializeSound(AM_STRING_TO_OS_STRING(filename), engine, id);
-            _pendingSoundsToLoad.push(id);
+            std::vector<AmSoundID> ids;
+            success = InitializeAssets<Sound>(
+                definition->sounds(), AM_OS_STRING("sounds"), "sound", state->sound_map, state->sound_id_map, engine, &ids);
+
+            for (const AmSoundID id : ids)
+                _pendingSoundsToLoad.push(id);
         }
 
         // Load each Collection named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->collections()->size(); ++i)
-        {
-            AmString sound_filename = definition->collections()->Get(i)->c_str();
-            success &= InitializeCollection(AM_STRING_TO_OS_STRING(sound_filename), engine);
-        }
+        success = success &&
+            InitializeAssets<Collection>(
+                definition->collections(), AM_OS_STRING("collections"), "collection", state->collection_map,
+                state->collection_id_map, engine);
 
         // Load each SwitchContainer named in the sound bank.
-        for (flatbuffers::uoffset_t i = 0; success && i < definition->switch_containers()->size(); ++i)
-        {
-            AmString filename = definition->switch_containers()->Get(i)->c_str();
-            success &= InitializeSwitchContainer(AM_STRING_TO_OS_STRING(filename), engine);
-        }
+        success = success &&
+            InitializeAssets<SwitchContainer>(
+                definition->switch_containers(), AM_OS_STRING("switch_containers"), "switch container",
+                state->switch_container_map, state->switch_container_id_map, engine);
 
         return success;
     }
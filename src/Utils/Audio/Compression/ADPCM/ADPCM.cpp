@@ -16,6 +16,7 @@
 // https://github.com/dbry/adpcm-xq
 
 #include <Utils/Audio/Compression/ADPCM/ADPCM.h>
+#include <Utils/Utils.h>
 #include <cstring>
 
 #define CLIP(v, a, b) v = AM_CLAMP(v, a, b)
@@ -378,4 +379,192 @@ namespace SparkyStudios::Audio::Amplitude::Compression::ADPCM
 
         return samples;
     }
+
+    /****************************** 4-bit ADPCM float decoder *****************************/
+
+    static constexpr AmReal32 kSampleScale = 1.0f / 32768.0f;
+
+    AM_INLINE(AmInt32) DecodeNibble(AmInt32& pcmData, AmInt32& index, AmUInt8 nibble)
+    {
+        const AmInt32 step = stepTable[index];
+        AmInt32 delta = step >> 3;
+
+        if (nibble & 1)
+            delta += (step >> 2);
+        if (nibble & 2)
+            delta += (step >> 1);
+        if (nibble & 4)
+            delta += step;
+        if (nibble & 8)
+            delta = -delta;
+
+        pcmData += delta;
+        index += indexTable[nibble & 0x7];
+        CLIP(index, 0, 88);
+        CLIP(pcmData, -32768, 32767);
+
+        return pcmData;
+    }
+
+    AmInt32 Decompress(AmAudioSampleBuffer out, AmConstUInt8Buffer in, AmSize inSize, AmUInt32 channels)
+    {
+        AmInt32 pcmData[2];
+        AmInt32 index[2];
+
+        if (inSize < channels * 4)
+            return 0;
+
+        for (AmUInt32 ch = 0; ch < channels; ch++)
+        {
+            pcmData[ch] = static_cast<AmInt16>(in[0] | (in[1] << 8));
+            index[ch] = in[2];
+
+            if (index[ch] > 88 || in[3]) // sanitize the input a little...
+                return 0;
+
+            *out++ = static_cast<AmReal32>(pcmData[ch]) * kSampleScale;
+
+            inSize -= 4;
+            in += 4;
+        }
+
+        AmSize chunks = inSize / (channels * 4);
+        const AmInt32 samples = 1 + static_cast<AmInt32>(chunks) * 8;
+
+        while (chunks--)
+        {
+            for (AmUInt32 ch = 0; ch < channels; ++ch)
+            {
+                for (AmUInt32 i = 0; i < 4; ++i)
+                {
+                    out[i * 2 * channels] = static_cast<AmReal32>(DecodeNibble(pcmData[ch], index[ch], *in & 0x0F)) * kSampleScale;
+                    out[(i * 2 + 1) * channels] = static_cast<AmReal32>(DecodeNibble(pcmData[ch], index[ch], *in >> 4)) * kSampleScale;
+
+                    in++;
+                }
+
+                out++;
+            }
+
+            out += channels * 7;
+        }
+
+        return samples;
+    }
+
+#if defined(AM_SIMD_INTRINSICS)
+    typedef xsimd::batch<AmInt32, xsimd::best_arch> AmADPCMLanes;
+
+    alignas(AmADPCMLanes::arch_type::alignment()) static const AmInt32 stepTable32[89] = {
+        7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,    31,    34,    37,
+        41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,   130,   143,   157,   173,   190,   209,
+        230,   253,   279,   307,   337,   371,   408,   449,   494,   544,   598,   658,   724,   796,   876,   963,   1060,  1166,
+        1282,  1411,  1552,  1707,  1878,  2066,  2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,
+        7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+    };
+
+    alignas(AmADPCMLanes::arch_type::alignment()) static const AmInt32 indexTable32[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+    AM_INLINE(AmADPCMLanes) DecodeNibbles(AmADPCMLanes& pcmData, AmADPCMLanes& index, const AmADPCMLanes& nibbles)
+    {
+        const AmADPCMLanes zero(0);
+        const AmADPCMLanes step = AmADPCMLanes::gather(stepTable32, index);
+
+        AmADPCMLanes delta = step >> 3;
+        delta += xsimd::select((nibbles & AmADPCMLanes(1)) != zero, step >> 2, zero);
+        delta += xsimd::select((nibbles & AmADPCMLanes(2)) != zero, step >> 1, zero);
+        delta += xsimd::select((nibbles & AmADPCMLanes(4)) != zero, step, zero);
+        delta = xsimd::select((nibbles & AmADPCMLanes(8)) != zero, -delta, delta);
+
+        pcmData = xsimd::clip(pcmData + delta, AmADPCMLanes(-32768), AmADPCMLanes(32767));
+        index = xsimd::clip(index + AmADPCMLanes::gather(indexTable32, nibbles & AmADPCMLanes(7)), zero, AmADPCMLanes(88));
+
+        return pcmData;
+    }
+#endif // AM_SIMD_INTRINSICS
+
+    AmUInt64 DecompressBlocks(AmAudioSampleBuffer out, AmConstUInt8Buffer in, AmSize blockSize, AmSize blockCount, AmUInt32 channels)
+    {
+        if (blockSize < channels * 4 || blockCount == 0)
+            return 0;
+
+        const AmSize chunks = (blockSize - channels * 4) / (channels * 4);
+        const AmUInt64 samplesPerBlock = 1 + chunks * 8;
+
+#if defined(AM_SIMD_INTRINSICS)
+        constexpr AmSize kLanes = AmADPCMLanes::size;
+
+        // Each lane decodes one channel of one block.
+        const AmSize streams = blockCount * channels;
+
+        alignas(AmADPCMLanes::arch_type::alignment()) AmInt32 laneData[kLanes];
+        alignas(AmADPCMLanes::arch_type::alignment()) AmInt32 laneIndex[kLanes];
+        alignas(AmADPCMLanes::arch_type::alignment()) AmInt32 laneNibbles[kLanes];
+        alignas(AmADPCMLanes::arch_type::alignment()) AmReal32 laneSamples[kLanes];
+
+        AmConstUInt8Buffer laneInput[kLanes];
+        AmAudioSampleBuffer laneOutput[kLanes];
+
+        for (AmSize first = 0; first < streams; first += kLanes)
+        {
+            const AmSize lanes = AM_MIN(kLanes, streams - first);
+
+            for (AmSize l = 0; l < kLanes; ++l)
+            {
+                // Unused lanes decode a copy of the first stream of the group, and their output is discarded.
+                const AmSize stream = first + (l < lanes ? l : 0);
+                const AmSize block = stream / channels;
+                const AmSize ch = stream % channels;
+
+                AmConstUInt8Buffer header = in + block * blockSize + ch * 4;
+
+                laneData[l] = static_cast<AmInt16>(header[0] | (header[1] << 8));
+                laneIndex[l] = header[2];
+
+                if (laneIndex[l] > 88 || header[3]) // sanitize the input a little...
+                    return 0;
+
+                laneInput[l] = in + block * blockSize + channels * 4 + ch * 4;
+                laneOutput[l] = out + block * samplesPerBlock * channels + ch;
+
+                laneOutput[l][0] = static_cast<AmReal32>(laneData[l]) * kSampleScale;
+                laneOutput[l] += channels;
+            }
+
+            auto pcmData = AmADPCMLanes::load_aligned(laneData);
+            auto index = AmADPCMLanes::load_aligned(laneIndex);
+            const auto scale = xsimd::batch<AmReal32, xsimd::best_arch>(kSampleScale);
+
+            for (AmSize c = 0; c < chunks; ++c)
+            {
+                for (AmSize i = 0; i < 4; ++i)
+                {
+                    for (AmSize l = 0; l < kLanes; ++l)
+                        laneNibbles[l] = laneInput[l][c * channels * 4 + i];
+
+                    const auto bytes = AmADPCMLanes::load_aligned(laneNibbles);
+
+                    xsimd::store_aligned(laneSamples, xsimd::to_float(DecodeNibbles(pcmData, index, bytes & AmADPCMLanes(0x0F))) * scale);
+                    for (AmSize l = 0; l < lanes; ++l)
+                        laneOutput[l][0] = laneSamples[l];
+
+                    xsimd::store_aligned(laneSamples, xsimd::to_float(DecodeNibbles(pcmData, index, bytes >> 4)) * scale);
+                    for (AmSize l = 0; l < lanes; ++l)
+                        laneOutput[l][channels] = laneSamples[l];
+
+                    for (AmSize l = 0; l < kLanes; ++l)
+                        laneOutput[l] += channels * 2;
+                }
+            }
+        }
+#else
+        for (AmSize block = 0; block < blockCount; ++block)
+        {
+            if (Decompress(out + block * samplesPerBlock * channels, in + block * blockSize, blockSize, channels) == 0)
+                return 0;
+        }
+#endif // AM_SIMD_INTRINSICS
+
+        return blockCount * samplesPerBlock;
+    }
 } // namespace SparkyStudios::Audio::Amplitude::Compression::ADPCM
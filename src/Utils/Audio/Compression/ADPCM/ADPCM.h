@@ -185,6 +185,36 @@ namespace SparkyStudios::Audio::Amplitude::Compression::ADPCM
      * @returns The number of converted composite samples (total samples divided by number of channels).
      */
     AmInt32 Decompress(AmInt16Buffer out, AmConstUInt8Buffer in, AmSize inSize, AmUInt32 channels);
+
+    /**
+     * @brief Decompresses the block of ADPCM data into normalized float32 PCM. This behaves like the
+     * 16-bit version, but writes samples in the [-1, 1] range, ready to be mixed.
+     *
+     * @param out Destination for interleaved PCM samples.
+     * @param in Source ADPCM block.
+     * @param inSize Size of source ADPCM block.
+     * @param channels Number of channels in block (must be determined from other context).
+     *
+     * @returns The number of converted composite samples (total samples divided by number of channels).
+     */
+    AmInt32 Decompress(AmAudioSampleBuffer out, AmConstUInt8Buffer in, AmSize inSize, AmUInt32 channels);
+
+    /**
+     * @brief Decompresses several consecutive ADPCM blocks of the same size into normalized float32 PCM.
+     *
+     * Each channel of each block is an independent stream, so when SIMD intrinsics are enabled, the streams
+     * are decoded in parallel vector lanes. Stereo blocks decode both channels side by side, and mono blocks
+     * decode several blocks at once.
+     *
+     * @param out Destination for interleaved PCM samples. The blocks are written one after the other.
+     * @param in Source ADPCM blocks.
+     * @param blockSize Size of one source ADPCM block.
+     * @param blockCount Number of blocks to decode.
+     * @param channels Number of channels in each block (must be determined from other context).
+     *
+     * @returns The number of converted composite samples, or 0 if one of the blocks is invalid.
+     */
+    AmUInt64 DecompressBlocks(AmAudioSampleBuffer out, AmConstUInt8Buffer in, AmSize blockSize, AmSize blockCount, AmUInt32 channels);
 } // namespace SparkyStudios::Audio::Amplitude::Compression::ADPCM
 
 #endif // SS_AMPLITUDE_AUDIO_COMPRESSION_ADPCM_H
@@ -43,7 +43,7 @@
 #define AM_FFT_PFFFT
 #endif
 #define AM_FFT_PFFFT_USED
-#include <Utils/pffft/pffft.h>
+#include <Utils/Audio/FFT/PFFFTSetupCache.h>
 #include <vector>
 #endif
 
@@ -118,7 +118,7 @@ namespace SparkyStudios::Audio::Amplitude
         {
             if (_pffft_setup != nullptr)
             {
-                pffft_destroy_setup(_pffft_setup);
+                PFFFTSetupCache::Release(_size);
                 _pffft_setup = nullptr;
             }
 
@@ -139,7 +139,7 @@ namespace SparkyStudios::Audio::Amplitude
             if (_size == 0)
                 return;
 
-            _pffft_setup = pffft_new_setup(_size, PFFFT_REAL);
+            _pffft_setup = PFFFTSetupCache::Acquire(_size);
             _buffer = static_cast<float*>(pffft_aligned_malloc(_size * sizeof(float)));
             _scratch = static_cast<float*>(pffft_aligned_malloc(_size * sizeof(float)));
         }
@@ -150,17 +150,20 @@ namespace SparkyStudios::Audio::Amplitude
 
             pffft_transform_ordered(_pffft_setup, _buffer, _buffer, _scratch, PFFFT_FORWARD);
 
-            // Convert back to split-complex
+            // Convert back to split-complex. PFFFT packs the real Nyquist bin in place of the imaginary part of the DC bin.
             {
-                float* b = _buffer;
-                float* bEnd = b + _size;
-                float* r = re;
-                float* i = im;
-                while (b != bEnd)
+                const size_t size2 = _size / 2;
+
+                for (size_t k = 1; k < size2; ++k)
                 {
-                    *r++ = *b++;
-                    *i++ = *b++;
+                    re[k] = _buffer[2 * k];
+                    im[k] = _buffer[2 * k + 1];
                 }
+
+                re[0] = _buffer[0];
+                im[0] = 0.0f;
+                re[size2] = _buffer[1];
+                im[size2] = 0.0f;
             }
         }
 
@@ -168,21 +171,22 @@ namespace SparkyStudios::Audio::Amplitude
         {
             // Convert into the format as required by the PFFFT
             {
-                float* b = _buffer;
-                float* bEnd = b + _size;
-                const float* r = re;
-                const float* i = im;
-                while (b != bEnd)
+                const size_t size2 = _size / 2;
+
+                for (size_t k = 1; k < size2; ++k)
                 {
-                    *b++ = *r++;
-                    *b++ = *i++;
+                    _buffer[2 * k] = re[k];
+                    _buffer[2 * k + 1] = im[k];
                 }
+
+                _buffer[0] = re[0];
+                _buffer[1] = re[size2];
             }
 
             pffft_transform_ordered(_pffft_setup, _buffer, _buffer, _scratch, PFFFT_BACKWARD);
 
-            // Convert back to split-complex
-            detail::ScaleBuffer(data, _buffer, 2.0f / static_cast<float>(_size), _size);
+            // PFFFT transforms are not normalized
+            detail::ScaleBuffer(data, _buffer, 1.0f / static_cast<float>(_size), _size);
         }
 
     private:
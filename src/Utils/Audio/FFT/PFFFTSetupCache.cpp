@@ -0,0 +1,69 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <mutex>
+
+#include <Utils/Audio/FFT/PFFFTSetupCache.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    struct PFFFTSetupEntry
+    {
+        PFFFT_Setup* setup = nullptr;
+        size_t references = 0;
+    };
+
+    static std::mutex& GetPFFFTSetupMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::map<size_t, PFFFTSetupEntry>& GetPFFFTSetupEntries()
+    {
+        static std::map<size_t, PFFFTSetupEntry> entries;
+        return entries;
+    }
+
+    PFFFT_Setup* PFFFTSetupCache::Acquire(size_t size)
+    {
+        std::lock_guard lock(GetPFFFTSetupMutex());
+
+        PFFFTSetupEntry& entry = GetPFFFTSetupEntries()[size];
+        if (entry.setup == nullptr)
+            entry.setup = pffft_new_setup(static_cast<int>(size), PFFFT_REAL);
+
+        if (entry.setup != nullptr)
+            entry.references++;
+
+        return entry.setup;
+    }
+
+    void PFFFTSetupCache::Release(size_t size)
+    {
+        std::lock_guard lock(GetPFFFTSetupMutex());
+
+        auto& entries = GetPFFFTSetupEntries();
+        const auto it = entries.find(size);
+        if (it == entries.end())
+            return;
+
+        if (--it->second.references == 0)
+        {
+            pffft_destroy_setup(it->second.setup);
+            entries.erase(it);
+        }
+    }
+} // namespace SparkyStudios::Audio::Amplitude
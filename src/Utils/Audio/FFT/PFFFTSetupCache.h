@@ -0,0 +1,53 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef SS_AMPLITUDE_AUDIO_PFFFT_SETUP_CACHE_H
+#define SS_AMPLITUDE_AUDIO_PFFFT_SETUP_CACHE_H
+
+#include <cstddef>
+
+#include <Utils/pffft/pffft.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief Shares the PFFFT setups of real transforms between all their users of the same size.
+     *
+     * A setup is only read during transforms, so users running on different threads can share it.
+     */
+    class PFFFTSetupCache
+    {
+    public:
+        /**
+         * @brief Gets the setup of a real transform of the given size, creating it if needed.
+         *
+         * @param size The size of the transform.
+         *
+         * @return The setup, or @c nullptr if the size is not supported by PFFFT.
+         */
+        static PFFFT_Setup* Acquire(size_t size);
+
+        /**
+         * @brief Releases a setup previously acquired with Acquire(). The setup is destroyed
+         * when it has no more users.
+         *
+         * @param size The size of the transform.
+         */
+        static void Release(size_t size);
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // SS_AMPLITUDE_AUDIO_PFFFT_SETUP_CACHE_H
@@ -0,0 +1,499 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <SparkyStudios/Audio/Amplitude/Core/Memory.h>
+
+#include <Utils/Audio/Filters/BiquadCascade.h>
+#include <Utils/Utils.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+#if defined(AM_SIMD_INTRINSICS)
+    constexpr AmSize kLaneWidth = AmAudioFrame::size;
+    constexpr AmSize kLaneAlignment = AmAudioFrame::arch_type::alignment();
+
+    AM_INLINE(AmAudioFrame) LoadLanes(const AmReal32* lanes)
+    {
+        return AmAudioFrame::load_aligned(lanes);
+    }
+
+    AM_INLINE(void) StoreLanes(AmReal32* lanes, const AmAudioFrame& value)
+    {
+        value.store_aligned(lanes);
+    }
+#else
+    constexpr AmSize kLaneWidth = 1;
+    constexpr AmSize kLaneAlignment = AM_SIMD_ALIGNMENT;
+
+    AM_INLINE(AmAudioFrame) LoadLanes(const AmReal32* lanes)
+    {
+        return *lanes;
+    }
+
+    AM_INLINE(void) StoreLanes(AmReal32* lanes, const AmAudioFrame& value)
+    {
+        *lanes = value;
+    }
+#endif // AM_SIMD_INTRINSICS
+
+    // The number of frames gathered from the lanes before running them through the stages.
+    constexpr AmUInt64 kChunkFrames = 64;
+
+    // Arrays of each stage: 5 coefficients, 5 targets, 5 increments and 2 states.
+    constexpr AmUInt32 kCoefficientsCount = 5;
+    constexpr AmUInt32 kTargetsOffset = kCoefficientsCount;
+    constexpr AmUInt32 kIncrementsOffset = kTargetsOffset + kCoefficientsCount;
+    constexpr AmUInt32 kStateOffset = kIncrementsOffset + kCoefficientsCount;
+    constexpr AmUInt32 kArraysPerStage = kStateOffset + 2;
+
+    static void ComputeOmega(AmReal32 frequency, AmUInt32 sampleRate, AmReal32& sinOmega, AmReal32& cosOmega)
+    {
+        const AmReal32 omega = 2.0f * M_PI * frequency / static_cast<AmReal32>(sampleRate);
+
+        sinOmega = std::sin(omega);
+        cosOmega = std::cos(omega);
+    }
+
+    BiquadCoefficients BiquadCoefficients::LowPass(AmReal32 frequency, AmReal32 q, AmUInt32 sampleRate)
+    {
+        AmReal32 sinOmega, cosOmega;
+        ComputeOmega(frequency, sampleRate, sinOmega, cosOmega);
+
+        const AmReal32 alpha = sinOmega / (2.0f * q);
+        const AmReal32 scalar = 1.0f / (1.0f + alpha);
+
+        BiquadCoefficients c;
+        c.a0 = 0.5f * (1.0f - cosOmega) * scalar;
+        c.a1 = (1.0f - cosOmega) * scalar;
+        c.a2 = c.a0;
+        c.b1 = -2.0f * cosOmega * scalar;
+        c.b2 = (1.0f - alpha) * scalar;
+
+        return c;
+    }
+
+    BiquadCoefficients BiquadCoefficients::HighPass(AmReal32 frequency, AmReal32 q, AmUInt32 sampleRate)
+    {
+        AmReal32 sinOmega, cosOmega;
+        ComputeOmega(frequency, sampleRate, sinOmega, cosOmega);
+
+        const AmReal32 alpha = sinOmega / (2.0f * q);
+        const AmReal32 scalar = 1.0f / (1.0f + alpha);
+
+        BiquadCoefficients c;
+        c.a0 = 0.5f * (1.0f + cosOmega) * scalar;
+        c.a1 = -(1.0f + cosOmega) * scalar;
+        c.a2 = c.a0;
+        c.b1 = -2.0f * cosOmega * scalar;
+        c.b2 = (1.0f - alpha) * scalar;
+
+        return c;
+    }
+
+    BiquadCoefficients BiquadCoefficients::BandPass(AmReal32 frequency, AmReal32 q, AmUInt32 sampleRate)
+    {
+        AmReal32 sinOmega, cosOmega;
+        ComputeOmega(frequency, sampleRate, sinOmega, cosOmega);
+
+        const AmReal32 alpha = sinOmega / (2.0f * q);
+        const AmReal32 scalar = 1.0f / (1.0f + alpha);
+
+        BiquadCoefficients c;
+        c.a0 = q * alpha * scalar;
+        c.a1 = 0.0f;
+        c.a2 = -c.a0;
+        c.b1 = -2.0f * cosOmega * scalar;
+        c.b2 = (1.0f - alpha) * scalar;
+
+        return c;
+    }
+
+    BiquadCoefficients BiquadCoefficients::Peak(AmReal32 frequency, AmReal32 q, AmReal32 gain, AmUInt32 sampleRate)
+    {
+        AmReal32 sinOmega, cosOmega;
+        ComputeOmega(frequency, sampleRate, sinOmega, cosOmega);
+
+        const AmReal32 A = std::pow(10.0f, gain / 40.0f);
+        const AmReal32 alpha = sinOmega / (2.0f * q);
+        const AmReal32 scalar = 1.0f / (1.0f + (alpha / A));
+
+        BiquadCoefficients c;
+        c.a0 = (1.0f + (alpha * A)) * scalar;
+        c.a1 = -2.0f * cosOmega * scalar;
+        c.a2 = (1.0f - (alpha * A)) * scalar;
+        c.b1 = -2.0f * cosOmega * scalar;
+        c.b2 = (1.0f - (alpha / A)) * scalar;
+
+        return c;
+    }
+
+    BiquadCoefficients BiquadCoefficients::Notch(AmReal32 frequency, AmReal32 q, AmUInt32 sampleRate)
+    {
+        AmReal32 sinOmega, cosOmega;
+        ComputeOmega(frequency, sampleRate, sinOmega, cosOmega);
+
+        const AmReal32 alpha = sinOmega / (2.0f * q);
+        const AmReal32 scalar = 1.0f / (1.0f + alpha);
+
+        BiquadCoefficients c;
+        c.a0 = 1.0f * scalar;
+        c.a1 = -2.0f * cosOmega * scalar;
+        c.a2 = c.a0;
+        c.b1 = -2.0f * cosOmega * scalar;
+        c.b2 = (1.0f - alpha) * scalar;
+
+        return c;
+    }
+
+    BiquadCoefficients BiquadCoefficients::LowShelf(AmReal32 frequency, AmReal32 s, AmReal32 gain, AmUInt32 sampleRate)
+    {
+        AmReal32 sinOmega, cosOmega;
+        ComputeOmega(frequency, sampleRate, sinOmega, cosOmega);
+
+        const AmReal32 A = std::pow(10.0f, gain / 40.0f);
+        const AmReal32 alpha = sinOmega / (2.0f * std::sqrt((A + 1.0f / A) * (1.0f / s - 1.0f) + 2.0f));
+        const AmReal32 beta = 2.0f * std::sqrt(A) * alpha;
+        const AmReal32 scalar = 1.0f / ((A + 1.0f) + (A - 1.0f) * cosOmega + beta);
+
+        BiquadCoefficients c;
+        c.a0 = (A * ((A + 1.0f) - (A - 1.0f) * cosOmega + beta)) * scalar;
+        c.a1 = (2.0f * A * ((A - 1.0f) - (A + 1.0f) * cosOmega)) * scalar;
+        c.a2 = (A * ((A + 1.0f) - (A - 1.0f) * cosOmega - beta)) * scalar;
+        c.b1 = (-2.0f * ((A - 1.0f) + (A + 1.0f) * cosOmega)) * scalar;
+        c.b2 = ((A + 1.0f) + (A - 1.0f) * cosOmega - beta) * scalar;
+
+        return c;
+    }
+
+    BiquadCoefficients BiquadCoefficients::HighShelf(AmReal32 frequency, AmReal32 s, AmReal32 gain, AmUInt32 sampleRate)
+    {
+        AmReal32 sinOmega, cosOmega;
+        ComputeOmega(frequency, sampleRate, sinOmega, cosOmega);
+
+        const AmReal32 A = std::pow(10.0f, gain / 40.0f);
+        const AmReal32 alpha = sinOmega / (2.0f * std::sqrt((A + 1.0f / A) * (1.0f / s - 1.0f) + 2.0f));
+        const AmReal32 beta = 2.0f * std::sqrt(A) * alpha;
+        const AmReal32 scalar = 1.0f / ((A + 1.0f) - (A - 1.0f) * cosOmega + beta);
+
+        BiquadCoefficients c;
+        c.a0 = (A * ((A + 1.0f) + (A - 1.0f) * cosOmega + beta)) * scalar;
+        c.a1 = (-2.0f * A * ((A - 1.0f) + (A + 1.0f) * cosOmega)) * scalar;
+        c.a2 = (A * ((A + 1.0f) + (A - 1.0f) * cosOmega - beta)) * scalar;
+        c.b1 = (2.0f * ((A - 1.0f) - (A + 1.0f) * cosOmega)) * scalar;
+        c.b2 = ((A + 1.0f) - (A - 1.0f) * cosOmega - beta) * scalar;
+
+        return c;
+    }
+
+    BiquadCoefficients BiquadCoefficients::WithWet(AmReal32 wet) const
+    {
+        // x + (H(z) - 1) * wet * x has the same poles as H(z), only the numerator changes.
+        const AmReal32 dry = 1.0f - wet;
+
+        BiquadCoefficients c;
+        c.a0 = dry + wet * a0;
+        c.a1 = dry * b1 + wet * a1;
+        c.a2 = dry * b2 + wet * a2;
+        c.b1 = b1;
+        c.b2 = b2;
+
+        return c;
+    }
+
+    BiquadCascade::BiquadCascade()
+        : _lanes(0)
+        , _capacity(0)
+        , _stages(0)
+        , _stride(0)
+        , _data(nullptr)
+        , _interpolating(false)
+    {}
+
+    BiquadCascade::~BiquadCascade()
+    {
+        Release();
+    }
+
+    void BiquadCascade::Initialize(AmUInt32 lanes, AmUInt32 stages)
+    {
+        Release();
+
+        _capacity = lanes;
+        _stages = stages;
+        _stride = static_cast<AmUInt32>(kLaneWidth * ((lanes + kLaneWidth - 1) / kLaneWidth));
+
+        const AmSize count = static_cast<AmSize>(_stride) * _stages * kArraysPerStage;
+        if (count == 0)
+            return;
+
+        _data = static_cast<AmReal32*>(ampoolmalign(MemoryPoolKind::Filtering, count * sizeof(AmReal32), kLaneAlignment));
+        std::memset(_data, 0, count * sizeof(AmReal32));
+
+        // Pass-through filters.
+        for (AmUInt32 s = 0; s < _stages; ++s)
+        {
+            std::fill_n(GetArray(s, 0), _stride, 1.0f);
+            std::fill_n(GetArray(s, kTargetsOffset), _stride, 1.0f);
+        }
+    }
+
+    void BiquadCascade::SetLaneCount(AmUInt32 lanes)
+    {
+        AMPLITUDE_ASSERT(lanes <= _capacity);
+
+        _lanes = AM_MIN(lanes, _capacity);
+        Reset();
+    }
+
+    void BiquadCascade::Reset()
+    {
+        for (AmUInt32 s = 0; s < _stages; ++s)
+            std::memset(GetArray(s, kStateOffset), 0, 2 * _stride * sizeof(AmReal32));
+    }
+
+    void BiquadCascade::SetCoefficients(AmUInt32 stage, AmUInt32 lane, const BiquadCoefficients& coefficients, bool interpolate)
+    {
+        AMPLITUDE_ASSERT(stage < _stages && lane < _lanes);
+
+        const AmReal32 values[kCoefficientsCount] = {
+            coefficients.a0, coefficients.a1, coefficients.a2, coefficients.b1, coefficients.b2,
+        };
+
+        for (AmUInt32 i = 0; i < kCoefficientsCount; ++i)
+        {
+            GetArray(stage, kTargetsOffset + i)[lane] = values[i];
+
+            if (!interpolate)
+                GetArray(stage, i)[lane] = values[i];
+        }
+
+        _interpolating = _interpolating || interpolate;
+    }
+
+    void BiquadCascade::Process(AmAudioSampleBuffer const* lanes, AmSize stride, AmUInt64 frames)
+    {
+        if (_data == nullptr || frames == 0)
+            return;
+
+        const bool interpolating = _interpolating;
+
+        if (interpolating)
+        {
+            const AmReal32 step = 1.0f / static_cast<AmReal32>(frames);
+
+            for (AmUInt32 s = 0; s < _stages; ++s)
+            {
+                for (AmUInt32 i = 0; i < kCoefficientsCount; ++i)
+                {
+                    const AmReal32* current = GetArray(s, i);
+                    const AmReal32* target = GetArray(s, kTargetsOffset + i);
+                    AmReal32* increment = GetArray(s, kIncrementsOffset + i);
+
+                    for (AmUInt32 l = 0; l < _stride; ++l)
+                        increment[l] = (target[l] - current[l]) * step;
+                }
+            }
+        }
+
+        // Each SIMD slot runs an independent recurrence, so the vector path wins as soon as there are two lanes
+        // or two stages, even with most slots empty. A single filter only pays for the transposition.
+        if (_lanes == 1 && _stages == 1)
+            ProcessScalar(lanes, stride, frames, interpolating);
+        else
+            ProcessVector(lanes, stride, frames, interpolating);
+
+        if (interpolating)
+        {
+            // Land exactly on the targets, the increments accumulate rounding errors.
+            for (AmUInt32 s = 0; s < _stages; ++s)
+                std::memcpy(GetArray(s, 0), GetArray(s, kTargetsOffset), kCoefficientsCount * _stride * sizeof(AmReal32));
+
+            _interpolating = false;
+        }
+    }
+
+    void BiquadCascade::ProcessScalar(AmAudioSampleBuffer const* lanes, AmSize stride, AmUInt64 frames, bool interpolating)
+    {
+        for (AmUInt32 l = 0; l < _lanes; ++l)
+        {
+            AmAudioSampleBuffer samples = lanes[l];
+
+            for (AmUInt32 s = 0; s < _stages; ++s)
+            {
+                AmReal32 a0 = GetArray(s, 0)[l];
+                AmReal32 a1 = GetArray(s, 1)[l];
+                AmReal32 a2 = GetArray(s, 2)[l];
+                AmReal32 b1 = GetArray(s, 3)[l];
+                AmReal32 b2 = GetArray(s, 4)[l];
+                AmReal32 z1 = GetArray(s, kStateOffset)[l];
+                AmReal32 z2 = GetArray(s, kStateOffset + 1)[l];
+
+                if (interpolating)
+                {
+                    const AmReal32 da0 = GetArray(s, kIncrementsOffset)[l];
+                    const AmReal32 da1 = GetArray(s, kIncrementsOffset + 1)[l];
+                    const AmReal32 da2 = GetArray(s, kIncrementsOffset + 2)[l];
+                    const AmReal32 db1 = GetArray(s, kIncrementsOffset + 3)[l];
+                    const AmReal32 db2 = GetArray(s, kIncrementsOffset + 4)[l];
+
+                    for (AmUInt64 f = 0; f < frames; ++f)
+                    {
+                        a0 += da0;
+                        a1 += da1;
+                        a2 += da2;
+                        b1 += db1;
+                        b2 += db2;
+
+                        const AmReal32 x = samples[f * stride];
+                        const AmReal32 y = a0 * x + z1;
+
+                        z1 = a1 * x - b1 * y + z2;
+                        z2 = a2 * x - b2 * y;
+
+                        samples[f * stride] = static_cast<AmAudioSample>(y);
+                    }
+                }
+                else
+                {
+                    for (AmUInt64 f = 0; f < frames; ++f)
+                    {
+                        const AmReal32 x = samples[f * stride];
+                        const AmReal32 y = a0 * x + z1;
+
+                        z1 = a1 * x - b1 * y + z2;
+                        z2 = a2 * x - b2 * y;
+
+                        samples[f * stride] = static_cast<AmAudioSample>(y);
+                    }
+                }
+
+                GetArray(s, kStateOffset)[l] = z1;
+                GetArray(s, kStateOffset + 1)[l] = z2;
+            }
+        }
+    }
+
+    void BiquadCascade::ProcessVector(AmAudioSampleBuffer const* lanes, AmSize stride, AmUInt64 frames, bool interpolating)
+    {
+        alignas(kLaneAlignment) AmReal32 chunk[kChunkFrames * kLaneWidth] = {};
+
+        for (AmUInt32 g = 0; g < _lanes; g += kLaneWidth)
+        {
+            const AmUInt32 count = AM_MIN(static_cast<AmUInt32>(kLaneWidth), _lanes - g);
+
+            for (AmUInt64 offset = 0; offset < frames; offset += kChunkFrames)
+            {
+                const AmUInt64 length = AM_MIN(kChunkFrames, frames - offset);
+
+                // Transpose the lanes into the chunk, one lane per SIMD slot.
+                for (AmUInt64 f = 0; f < length; ++f)
+                    for (AmUInt32 l = 0; l < count; ++l)
+                        chunk[f * kLaneWidth + l] = lanes[g + l][(offset + f) * stride];
+
+                for (AmUInt32 s = 0; s < _stages; ++s)
+                {
+                    AmAudioFrame a0 = LoadLanes(GetArray(s, 0) + g);
+                    AmAudioFrame a1 = LoadLanes(GetArray(s, 1) + g);
+                    AmAudioFrame a2 = LoadLanes(GetArray(s, 2) + g);
+                    AmAudioFrame b1 = LoadLanes(GetArray(s, 3) + g);
+                    AmAudioFrame b2 = LoadLanes(GetArray(s, 4) + g);
+                    AmAudioFrame z1 = LoadLanes(GetArray(s, kStateOffset) + g);
+                    AmAudioFrame z2 = LoadLanes(GetArray(s, kStateOffset + 1) + g);
+
+                    if (interpolating)
+                    {
+                        const AmAudioFrame da0 = LoadLanes(GetArray(s, kIncrementsOffset) + g);
+                        const AmAudioFrame da1 = LoadLanes(GetArray(s, kIncrementsOffset + 1) + g);
+                        const AmAudioFrame da2 = LoadLanes(GetArray(s, kIncrementsOffset + 2) + g);
+                        const AmAudioFrame db1 = LoadLanes(GetArray(s, kIncrementsOffset + 3) + g);
+                        const AmAudioFrame db2 = LoadLanes(GetArray(s, kIncrementsOffset + 4) + g);
+
+                        for (AmUInt64 f = 0; f < length; ++f)
+                        {
+                            a0 += da0;
+                            a1 += da1;
+                            a2 += da2;
+                            b1 += db1;
+                            b2 += db2;
+
+                            const AmAudioFrame x = LoadLanes(chunk + f * kLaneWidth);
+                            const AmAudioFrame y = a0 * x + z1;
+
+                            z1 = a1 * x - b1 * y + z2;
+                            z2 = a2 * x - b2 * y;
+
+                            StoreLanes(chunk + f * kLaneWidth, y);
+                        }
+
+                        StoreLanes(GetArray(s, 0) + g, a0);
+                        StoreLanes(GetArray(s, 1) + g, a1);
+                        StoreLanes(GetArray(s, 2) + g, a2);
+                        StoreLanes(GetArray(s, 3) + g, b1);
+                        StoreLanes(GetArray(s, 4) + g, b2);
+                    }
+                    else
+                    {
+                        for (AmUInt64 f = 0; f < length; ++f)
+                        {
+                            const AmAudioFrame x = LoadLanes(chunk + f * kLaneWidth);
+                            const AmAudioFrame y = a0 * x + z1;
+
+                            z1 = a1 * x - b1 * y + z2;
+                            z2 = a2 * x - b2 * y;
+
+                            StoreLanes(chunk + f * kLaneWidth, y);
+                        }
+                    }
+
+                    StoreLanes(GetArray(s, kStateOffset) + g, z1);
+                    StoreLanes(GetArray(s, kStateOffset + 1) + g, z2);
+                }
+
+                for (AmUInt64 f = 0; f < length; ++f)
+                    for (AmUInt32 l = 0; l < count; ++l)
+                        lanes[g + l][(offset + f) * stride] = static_cast<AmAudioSample>(chunk[f * kLaneWidth + l]);
+            }
+        }
+    }
+
+    void BiquadCascade::ProcessInterleaved(AmAudioSampleBuffer buffer, AmUInt64 frames)
+    {
+        AmAudioSampleBuffer lanes[AM_MAX_CHANNELS];
+
+        AMPLITUDE_ASSERT(_lanes <= AM_MAX_CHANNELS);
+
+        for (AmUInt32 l = 0; l < _lanes; ++l)
+            lanes[l] = buffer + l;
+
+        Process(lanes, _lanes, frames);
+    }
+
+    void BiquadCascade::Release()
+    {
+        if (_data != nullptr)
+            ampoolfree(MemoryPoolKind::Filtering, _data);
+
+        _data = nullptr;
+        _lanes = 0;
+        _capacity = 0;
+        _stages = 0;
+        _stride = 0;
+        _interpolating = false;
+    }
+
+    AmReal32* BiquadCascade::GetArray(AmUInt32 stage, AmUInt32 index) const
+    {
+        return _data + (static_cast<AmSize>(stage) * kArraysPerStage + index) * _stride;
+    }
+} // namespace SparkyStudios::Audio::Amplitude
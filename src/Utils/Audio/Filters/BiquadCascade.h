@@ -0,0 +1,182 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#ifndef SS_AMPLITUDE_AUDIO_BIQUAD_CASCADE_H
+#define SS_AMPLITUDE_AUDIO_BIQUAD_CASCADE_H
+
+#include <SparkyStudios/Audio/Amplitude/Core/Common.h>
+
+namespace SparkyStudios::Audio::Amplitude
+{
+    /**
+     * @brief The coefficients of a biquad filter, normalized so that the first feedback coefficient is 1.
+     *
+     * a0, a1 and a2 are the feedforward coefficients, b1 and b2 are the feedback coefficients.
+     * The factory methods follow the formulas of the Audio EQ Cookbook by Robert Bristow-Johnson.
+     */
+    struct BiquadCoefficients
+    {
+        AmReal32 a0 = 1.0f;
+        AmReal32 a1 = 0.0f;
+        AmReal32 a2 = 0.0f;
+        AmReal32 b1 = 0.0f;
+        AmReal32 b2 = 0.0f;
+
+        static BiquadCoefficients LowPass(AmReal32 frequency, AmReal32 q, AmUInt32 sampleRate);
+
+        static BiquadCoefficients HighPass(AmReal32 frequency, AmReal32 q, AmUInt32 sampleRate);
+
+        static BiquadCoefficients BandPass(AmReal32 frequency, AmReal32 q, AmUInt32 sampleRate);
+
+        static BiquadCoefficients Peak(AmReal32 frequency, AmReal32 q, AmReal32 gain, AmUInt32 sampleRate);
+
+        static BiquadCoefficients Notch(AmReal32 frequency, AmReal32 q, AmUInt32 sampleRate);
+
+        static BiquadCoefficients LowShelf(AmReal32 frequency, AmReal32 s, AmReal32 gain, AmUInt32 sampleRate);
+
+        static BiquadCoefficients HighShelf(AmReal32 frequency, AmReal32 s, AmReal32 gain, AmUInt32 sampleRate);
+
+        /**
+         * @brief Folds a dry/wet mix into the coefficients.
+         *
+         * The returned filter outputs <code>x + (y - x) * wet</code>, where x is the input
+         * and y the output of this filter.
+         *
+         * @param wet The amount of filtered signal in the output.
+         *
+         * @return The coefficients of the mixed filter.
+         */
+        [[nodiscard]] BiquadCoefficients WithWet(AmReal32 wet) const;
+    };
+
+    /**
+     * @brief Runs many independent cascades of biquad filters at once.
+     *
+     * Each lane is an independent signal with its own coefficients and state for each stage of
+     * the cascade. Filters use one lane per channel of the sound they process: the mixer runs the
+     * pipeline of each sound separately, so lanes are never shared between voices. Lanes are
+     * stored side by side, so that a SIMD register processes as many lanes as it has floats, using
+     * a transposed direct form II. A cascade with a single lane and a single stage runs without
+     * SIMD, which avoids transposing its samples.
+     *
+     * New coefficients are interpolated from the previous ones across the next processed block,
+     * which allows to sweep the filters without zipper noise.
+     */
+    class BiquadCascade
+    {
+    public:
+        BiquadCascade();
+        ~BiquadCascade();
+
+        BiquadCascade(const BiquadCascade&) = delete;
+        BiquadCascade& operator=(const BiquadCascade&) = delete;
+
+        /**
+         * @brief Allocates the cascade. All the stages of all the lanes are reset to pass-through filters.
+         *
+         * No lane is processed until SetLaneCount() is called. Filters should initialize their cascade
+         * when they are created, so that nothing is allocated while processing.
+         *
+         * @param lanes The maximum number of independent signals to process.
+         * @param stages The number of biquad filters applied in series on each lane.
+         */
+        void Initialize(AmUInt32 lanes, AmUInt32 stages);
+
+        /**
+         * @brief Sets the number of lanes to process, without allocating memory.
+         *
+         * The state of all the filters is cleared.
+         *
+         * @param lanes The number of lanes to process. It can't exceed the number of lanes the cascade
+         * was initialized with.
+         */
+        void SetLaneCount(AmUInt32 lanes);
+
+        /**
+         * @brief Clears the state of all the filters, without changing their coefficients.
+         */
+        void Reset();
+
+        /**
+         * @brief Sets the coefficients of a stage of a lane.
+         *
+         * @param stage The index of the stage.
+         * @param lane The index of the lane.
+         * @param coefficients The new coefficients.
+         * @param interpolate Whether to interpolate from the current coefficients during the next
+         * processed block, or to use the new coefficients right away.
+         */
+        void SetCoefficients(AmUInt32 stage, AmUInt32 lane, const BiquadCoefficients& coefficients, bool interpolate = true);
+
+        /**
+         * @brief Filters the given lanes in place.
+         *
+         * The i-th sample of a lane is located at <code>lanes[lane][i * stride]</code>. Lanes may
+         * point into different buffers.
+         *
+         * @param lanes The first sample of each lane. There must be GetLaneCount() pointers.
+         * @param stride The distance between two consecutive samples of a lane.
+         * @param frames The number of samples to process in each lane.
+         */
+        void Process(AmAudioSampleBuffer const* lanes, AmSize stride, AmUInt64 frames);
+
+        /**
+         * @brief Filters an interleaved buffer in place, with one lane per channel.
+         *
+         * @param buffer The interleaved buffer. It must have GetLaneCount() channels.
+         * @param frames The number of frames to process.
+         */
+        void ProcessInterleaved(AmAudioSampleBuffer buffer, AmUInt64 frames);
+
+        /**
+         * @brief Gets the number of lanes processed by the cascade.
+         *
+         * @return The number of lanes.
+         */
+        [[nodiscard]] AmUInt32 GetLaneCount() const
+        {
+            return _lanes;
+        }
+
+        /**
+         * @brief Gets the number of stages of the cascade.
+         *
+         * @return The number of stages.
+         */
+        [[nodiscard]] AmUInt32 GetStageCount() const
+        {
+            return _stages;
+        }
+
+    private:
+        void ProcessScalar(AmAudioSampleBuffer const* lanes, AmSize stride, AmUInt64 frames, bool interpolating);
+        void ProcessVector(AmAudioSampleBuffer const* lanes, AmSize stride, AmUInt64 frames, bool interpolating);
+        void Release();
+
+        [[nodiscard]] AmReal32* GetArray(AmUInt32 stage, AmUInt32 index) const;
+
+        AmUInt32 _lanes;
+        AmUInt32 _capacity;
+        AmUInt32 _stages;
+        AmUInt32 _stride;
+
+        // Coefficients, targets, increments and states, each stored as one array of _stride lanes.
+        AmReal32* _data;
+        bool _interpolating;
+    };
+} // namespace SparkyStudios::Audio::Amplitude
+
+#endif // SS_AMPLITUDE_AUDIO_BIQUAD_CASCADE_H
@@ -0,0 +1,212 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Based on code written by Jezar at Dreampoint, June 2000 http://www.dreampoint.co.uk,
+// which was placed in public domain.
+
+#include <cfloat>
+#include <cstring>
+
+#include <Utils/Utils.h>
+
+#include "CombBank.h"
+#include "denormals.h"
+
+namespace Freeverb
+{
+#if defined(AM_SIMD_INTRINSICS)
+    constexpr AmUInt32 kLaneWidth = AmAudioFrame::size;
+
+    // The number of registers holding the combs of each channel. When the combs of a channel don't fill
+    // whole registers, the combs are processed without SIMD, and this value is unused.
+    constexpr AmUInt32 kChannelVectors = AM_MAX(kNumCombs / kLaneWidth, 1);
+
+    AM_INLINE(AmAudioFrame) LoadLanes(const AmReal32* lanes)
+    {
+        return AmAudioFrame::load_unaligned(lanes);
+    }
+
+    AM_INLINE(void) StoreLanes(AmReal32* lanes, const AmAudioFrame& value)
+    {
+        value.store_unaligned(lanes);
+    }
+
+    // Same as undenormalise(): zeroes the values with a null exponent.
+    AM_INLINE(AmAudioFrame) Undenormalise(const AmAudioFrame& value)
+    {
+        return xsimd::select(xsimd::abs(value) < AmAudioFrame(FLT_MIN), AmAudioFrame(0.0f), value);
+    }
+#endif // AM_SIMD_INTRINSICS
+
+    static_assert(CombBank::kBlockFrames <= kCombTuningL1, "The blocks must not exceed the shortest comb delay.");
+
+    CombBank::CombBank()
+        : _feedback(0.0f)
+        , _damp1(0.0f)
+        , _damp2(1.0f)
+        , _filterStore()
+        , _buffers()
+        , _bufferSizes()
+        , _bufferIndices()
+#if defined(AM_SIMD_INTRINSICS)
+        , _block()
+#endif // AM_SIMD_INTRINSICS
+    {}
+
+    void CombBank::SetBuffer(AmUInt32 lane, AmReal32Buffer buffer, AmInt32 size)
+    {
+        _buffers[lane] = buffer;
+        _bufferSizes[lane] = size;
+        _bufferIndices[lane] = 0;
+    }
+
+    void CombBank::Mute()
+    {
+        for (AmUInt32 lane = 0; lane < kLanesCount; lane++)
+            std::memset(_buffers[lane], 0, _bufferSizes[lane] * sizeof(AmReal32));
+    }
+
+    void CombBank::SetDamp(AmReal32 value)
+    {
+        _damp1 = value;
+        _damp2 = 1 - value;
+    }
+
+    void CombBank::SetFeedback(AmReal32 value)
+    {
+        _feedback = value;
+    }
+
+    void CombBank::Process(const AmReal32* input, AmReal32* outputL, AmReal32* outputR, AmUInt32 frames)
+    {
+        AMPLITUDE_ASSERT(frames <= kBlockFrames);
+
+#if defined(AM_SIMD_INTRINSICS)
+        // Wide registers, like AVX-512 ones, can hold more lanes than the combs of a channel.
+        if constexpr (kLaneWidth > kNumCombs || kNumCombs % kLaneWidth != 0)
+            ProcessScalar(input, outputL, outputR, frames);
+        else
+            ProcessVector(input, outputL, outputR, frames);
+#else
+        ProcessScalar(input, outputL, outputR, frames);
+#endif // AM_SIMD_INTRINSICS
+    }
+
+#if defined(AM_SIMD_INTRINSICS)
+    void CombBank::ProcessVector(const AmReal32* input, AmReal32* outputL, AmReal32* outputR, AmUInt32 frames)
+    {
+        // Each comb reads and writes the same position, and a block never wraps over a full
+        // delay line, so the whole block can be read before being written back.
+        for (AmUInt32 lane = 0; lane < kLanesCount; lane++)
+        {
+            const AmReal32* buffer = _buffers[lane];
+            const AmUInt32 index = _bufferIndices[lane];
+            const AmUInt32 head = AM_MIN(frames, _bufferSizes[lane] - index);
+
+            AmReal32* lanes = _block + lane;
+
+            for (AmUInt32 f = 0; f < head; f++)
+                lanes[f * kLanesCount] = buffer[index + f];
+
+            for (AmUInt32 f = head; f < frames; f++)
+                lanes[f * kLanesCount] = buffer[f - head];
+        }
+
+        const AmAudioFrame damp1(_damp1);
+        const AmAudioFrame damp2(_damp2);
+        const AmAudioFrame feedback(_feedback);
+
+        AmAudioFrame filterStore[2 * kChannelVectors];
+        for (AmUInt32 v = 0; v < 2 * kChannelVectors; v++)
+            filterStore[v] = LoadLanes(_filterStore + v * kLaneWidth);
+
+        for (AmUInt32 f = 0; f < frames; f++)
+        {
+            AmReal32* lanes = _block + f * kLanesCount;
+            const AmAudioFrame in(input[f]);
+
+            AmAudioFrame sum[2] = { AmAudioFrame(0.0f), AmAudioFrame(0.0f) };
+
+            for (AmUInt32 v = 0; v < 2 * kChannelVectors; v++)
+            {
+                const AmAudioFrame output = Undenormalise(LoadLanes(lanes + v * kLaneWidth));
+
+                filterStore[v] = Undenormalise(output * damp2 + filterStore[v] * damp1);
+                StoreLanes(lanes + v * kLaneWidth, in + filterStore[v] * feedback);
+
+                sum[v / kChannelVectors] += output;
+            }
+
+            outputL[f] = xsimd::reduce_add(sum[0]);
+            outputR[f] = xsimd::reduce_add(sum[1]);
+        }
+
+        for (AmUInt32 v = 0; v < 2 * kChannelVectors; v++)
+            StoreLanes(_filterStore + v * kLaneWidth, filterStore[v]);
+
+        for (AmUInt32 lane = 0; lane < kLanesCount; lane++)
+        {
+            AmReal32* buffer = _buffers[lane];
+            const AmUInt32 size = _bufferSizes[lane];
+            const AmUInt32 index = _bufferIndices[lane];
+            const AmUInt32 head = AM_MIN(frames, size - index);
+
+            const AmReal32* lanes = _block + lane;
+
+            for (AmUInt32 f = 0; f < head; f++)
+                buffer[index + f] = lanes[f * kLanesCount];
+
+            for (AmUInt32 f = head; f < frames; f++)
+                buffer[f - head] = lanes[f * kLanesCount];
+
+            _bufferIndices[lane] = head < frames ? frames - head : (index + frames) % size;
+        }
+    }
+#endif // AM_SIMD_INTRINSICS
+
+    void CombBank::ProcessScalar(const AmReal32* input, AmReal32* outputL, AmReal32* outputR, AmUInt32 frames)
+    {
+        std::memset(outputL, 0, frames * sizeof(AmReal32));
+        std::memset(outputR, 0, frames * sizeof(AmReal32));
+
+        // Each comb runs on the whole block, without gathering the lanes.
+        for (AmUInt32 lane = 0; lane < kLanesCount; lane++)
+        {
+            AmReal32* buffer = _buffers[lane];
+            AmReal32* output = lane < kNumCombs ? outputL : outputR;
+            const AmUInt32 size = _bufferSizes[lane];
+
+            AmReal32 filterStore = _filterStore[lane];
+            AmUInt32 i = _bufferIndices[lane];
+
+            for (AmUInt32 f = 0; f < frames; f++)
+            {
+                AmReal32 delayed = buffer[i];
+                undenormalise(delayed);
+
+                filterStore = (delayed * _damp2) + (filterStore * _damp1);
+                undenormalise(filterStore);
+
+                buffer[i] = input[f] + (filterStore * _feedback);
+                output[f] += delayed;
+
+                if (++i >= size)
+                    i = 0;
+            }
+
+            _filterStore[lane] = filterStore;
+            _bufferIndices[lane] = i;
+        }
+    }
+} // namespace Freeverb
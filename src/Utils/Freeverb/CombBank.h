@@ -0,0 +1,89 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Based on code written by Jezar at Dreampoint, June 2000 http://www.dreampoint.co.uk,
+// which was placed in public domain.
+
+#pragma once
+
+#ifndef SS_AMPLITUDE_AUDIO_COMB_BANK_H
+#define SS_AMPLITUDE_AUDIO_COMB_BANK_H
+
+#include <SparkyStudios/Audio/Amplitude/Core/Common.h>
+
+#include "tuning.h"
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+namespace Freeverb
+{
+    /**
+     * @brief The parallel comb filters of both channels of the reverb.
+     *
+     * The combs are processed as lanes: the left combs come first, then the right combs. With
+     * SIMD, the delayed samples of a block of frames are gathered from all the combs, so that
+     * each frame holds the samples of all the lanes. Each step of the filters then processes as
+     * many combs as the SIMD registers can hold. When the combs of a channel don't fill whole
+     * registers, the combs are processed without SIMD.
+     */
+    class CombBank
+    {
+    public:
+        static constexpr AmUInt32 kLanesCount = 2 * kNumCombs;
+
+        // The number of frames processed at once. It must not exceed the shortest comb delay.
+        static constexpr AmUInt32 kBlockFrames = 128;
+
+        CombBank();
+
+        void SetBuffer(AmUInt32 lane, AmReal32Buffer buffer, AmInt32 size);
+        void Mute();
+        void SetDamp(AmReal32 value);
+        void SetFeedback(AmReal32 value);
+
+        /**
+         * @brief Runs the combs on the given input.
+         *
+         * @param input The input of the combs.
+         * @param outputL Receives the sum of the left combs.
+         * @param outputR Receives the sum of the right combs.
+         * @param frames The number of frames to process. Must not exceed kBlockFrames.
+         */
+        void Process(const AmReal32* input, AmReal32* outputL, AmReal32* outputR, AmUInt32 frames);
+
+    private:
+        void ProcessScalar(const AmReal32* input, AmReal32* outputL, AmReal32* outputR, AmUInt32 frames);
+
+#if defined(AM_SIMD_INTRINSICS)
+        void ProcessVector(const AmReal32* input, AmReal32* outputL, AmReal32* outputR, AmUInt32 frames);
+#endif // AM_SIMD_INTRINSICS
+
+        AmReal32 _feedback;
+        AmReal32 _damp1;
+        AmReal32 _damp2;
+
+        AmReal32 _filterStore[kLanesCount];
+
+        AmReal32Buffer _buffers[kLanesCount];
+        AmUInt32 _bufferSizes[kLanesCount];
+        AmUInt32 _bufferIndices[kLanesCount];
+
+#if defined(AM_SIMD_INTRINSICS)
+        // The delayed samples of a block, then the samples to write back in the delay lines.
+        AmReal32 _block[kBlockFrames * kLanesCount];
+#endif // AM_SIMD_INTRINSICS
+    };
+} // namespace Freeverb
+
+#endif // SS_AMPLITUDE_AUDIO_COMB_BANK_H
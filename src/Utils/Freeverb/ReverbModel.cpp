@@ -24,22 +24,22 @@ namespace Freeverb
     ReverbModel::ReverbModel()
     {
         // Tie the components to their buffers
-        _combL[0].SetBuffer(_bufCombL1, kCombTuningL1);
-        _combR[0].SetBuffer(_bufCombR1, kCombTuningR1);
-        _combL[1].SetBuffer(_bufCombL2, kCombTuningL2);
-        _combR[1].SetBuffer(_bufCombR2, kCombTuningR2);
-        _combL[2].SetBuffer(_bufCombL3, kCombTuningL3);
-        _combR[2].SetBuffer(_bufCombR3, kCombTuningR3);
-        _combL[3].SetBuffer(_bufCombL4, kCombTuningL4);
-        _combR[3].SetBuffer(_bufCombR4, kCombTuningR4);
-        _combL[4].SetBuffer(_bufCombL5, kCombTuningL5);
-        _combR[4].SetBuffer(_bufCombR5, kCombTuningR5);
-        _combL[5].SetBuffer(_bufCombL6, kCombTuningL6);
-        _combR[5].SetBuffer(_bufCombR6, kCombTuningR6);
-        _combL[6].SetBuffer(_bufCombL7, kCombTuningL7);
-        _combR[6].SetBuffer(_bufCombR7, kCombTuningR7);
-        _combL[7].SetBuffer(_bufCombL8, kCombTuningL8);
-        _combR[7].SetBuffer(_bufCombR8, kCombTuningR8);
+        _combs.SetBuffer(0, _bufCombL1, kCombTuningL1);
+        _combs.SetBuffer(kNumCombs + 0, _bufCombR1, kCombTuningR1);
+        _combs.SetBuffer(1, _bufCombL2, kCombTuningL2);
+        _combs.SetBuffer(kNumCombs + 1, _bufCombR2, kCombTuningR2);
+        _combs.SetBuffer(2, _bufCombL3, kCombTuningL3);
+        _combs.SetBuffer(kNumCombs + 2, _bufCombR3, kCombTuningR3);
+        _combs.SetBuffer(3, _bufCombL4, kCombTuningL4);
+        _combs.SetBuffer(kNumCombs + 3, _bufCombR4, kCombTuningR4);
+        _combs.SetBuffer(4, _bufCombL5, kCombTuningL5);
+        _combs.SetBuffer(kNumCombs + 4, _bufCombR5, kCombTuningR5);
+        _combs.SetBuffer(5, _bufCombL6, kCombTuningL6);
+        _combs.SetBuffer(kNumCombs + 5, _bufCombR6, kCombTuningR6);
+        _combs.SetBuffer(6, _bufCombL7, kCombTuningL7);
+        _combs.SetBuffer(kNumCombs + 6, _bufCombR7, kCombTuningR7);
+        _combs.SetBuffer(7, _bufCombL8, kCombTuningL8);
+        _combs.SetBuffer(kNumCombs + 7, _bufCombR8, kCombTuningR8);
         _allPassL[0].SetBuffer(_bufAllPassL1, kAllPassTuningL1);
         _allPassR[0].SetBuffer(_bufAllPassR1, kAllPassTuningR1);
         _allPassL[1].SetBuffer(_bufAllPassL2, kAllPassTuningL2);
@@ -74,11 +74,8 @@ namespace Freeverb
         if (GetMode() >= kFreezeMode)
             return;
 
-        for (AmInt32 i = 0; i < kNumCombs; i++)
-        {
-            _combL[i].Mute();
-            _combR[i].Mute();
-        }
+        _combs.Mute();
+
         for (AmInt32 i = 0; i < kNumAllPasses; i++)
         {
             _allPassL[i].Mute();
@@ -89,84 +86,100 @@ namespace Freeverb
     void ReverbModel::ProcessReplace(
         AmAudioSampleBuffer inputL, AmAudioSampleBuffer inputR, AmAudioSampleBuffer outputL, AmAudioSampleBuffer outputR, AmUInt64 frames, AmUInt32 skip)
     {
-        AmReal32 outL, outR, input;
+        AmReal32 input[CombBank::kBlockFrames];
+        AmReal32 combL[CombBank::kBlockFrames];
+        AmReal32 combR[CombBank::kBlockFrames];
 
         if (_dirty)
             Update();
 
-        while (frames-- > 0)
+        while (frames > 0)
         {
-            outL = outR = 0;
-            input = (*inputL + *inputR) * _gain;
+            const auto count = static_cast<AmUInt32>(AM_MIN(frames, CombBank::kBlockFrames));
+
+            for (AmUInt32 i = 0; i < count; i++)
+                input[i] = (inputL[i * skip] + inputR[i * skip]) * _gain;
 
             // Accumulate comb filters in parallel
-            for (AmUInt32 i = 0; i < kNumCombs; i++)
-            {
-                outL += _combL[i].Process(input);
-                outR += _combR[i].Process(input);
-            }
+            _combs.Process(input, combL, combR, count);
 
-            // Feed through allpasses in series
-            for (AmUInt32 i = 0; i < kNumAllPasses; i++)
+            for (AmUInt32 i = 0; i < count; i++)
             {
-                outL = _allPassL[i].Process(outL);
-                outR = _allPassR[i].Process(outR);
+                AmReal32 outL = combL[i];
+                AmReal32 outR = combR[i];
+
+                // Feed through allpasses in series
+                for (AmUInt32 j = 0; j < kNumAllPasses; j++)
+                {
+                    outL = _allPassL[j].Process(outL);
+                    outR = _allPassR[j].Process(outR);
+                }
+
+                // Calculate output REPLACING anything already there
+                outL = outL * _wet1 + outR * _wet2 + *inputL * _dry;
+                outR = outR * _wet1 + outL * _wet2 + *inputR * _dry;
+
+                undenormalise(outL);
+                undenormalise(outR);
+
+                *outputL = outL;
+                *outputR = outR;
+
+                // Increment sample pointers, allowing for interleave (if any)
+                inputL += skip;
+                inputR += skip;
+                outputL += skip;
+                outputR += skip;
             }
 
-            // Calculate output REPLACING anything already there
-            outL = outL * _wet1 + outR * _wet2 + *inputL * _dry;
-            outR = outR * _wet1 + outL * _wet2 + *inputR * _dry;
-
-            undenormalise(outL);
-            undenormalise(outR);
-
-            *outputL = outL;
-            *outputR = outR;
-
-            // Increment sample pointers, allowing for interleave (if any)
-            inputL += skip;
-            inputR += skip;
-            outputL += skip;
-            outputR += skip;
+            frames -= count;
         }
     }
 
     void ReverbModel::ProcessMix(
         AmAudioSampleBuffer inputL, AmAudioSampleBuffer inputR, AmAudioSampleBuffer outputL, AmAudioSampleBuffer outputR, AmUInt64 frames, AmUInt32 skip)
     {
-        AmReal32 outL, outR, input;
+        AmReal32 input[CombBank::kBlockFrames];
+        AmReal32 combL[CombBank::kBlockFrames];
+        AmReal32 combR[CombBank::kBlockFrames];
 
         if (_dirty)
             Update();
 
-        while (frames-- > 0)
+        while (frames > 0)
         {
-            outL = outR = 0;
-            input = (*inputL + *inputR) * _gain;
+            const auto count = static_cast<AmUInt32>(AM_MIN(frames, CombBank::kBlockFrames));
+
+            for (AmUInt32 i = 0; i < count; i++)
+                input[i] = (inputL[i * skip] + inputR[i * skip]) * _gain;
 
             // Accumulate comb filters in parallel
-            for (AmUInt32 i = 0; i < kNumCombs; i++)
-            {
-                outL += _combL[i].Process(input);
-                outR += _combR[i].Process(input);
-            }
+            _combs.Process(input, combL, combR, count);
 
-            // Feed through allpasses in series
-            for (AmUInt32 i = 0; i < kNumAllPasses; i++)
+            for (AmUInt32 i = 0; i < count; i++)
             {
-                outL = _allPassL[i].Process(outL);
-                outR = _allPassR[i].Process(outR);
+                AmReal32 outL = combL[i];
+                AmReal32 outR = combR[i];
+
+                // Feed through allpasses in series
+                for (AmUInt32 j = 0; j < kNumAllPasses; j++)
+                {
+                    outL = _allPassL[j].Process(outL);
+                    outR = _allPassR[j].Process(outR);
+                }
+
+                // Calculate output MIXING with anything already there
+                *outputL += outL * _wet1 + outR * _wet2 + *inputL * _dry;
+                *outputR += outR * _wet1 + outL * _wet2 + *inputR * _dry;
+
+                // Increment sample pointers, allowing for interleave (if any)
+                inputL += skip;
+                inputR += skip;
+                outputL += skip;
+                outputR += skip;
             }
 
-            // Calculate output MIXING with anything already there
-            *outputL += outL * _wet1 + outR * _wet2 + *inputL * _dry;
-            *outputR += outR * _wet1 + outL * _wet2 + *inputR * _dry;
-
-            // Increment sample pointers, allowing for interleave (if any)
-            inputL += skip;
-            inputR += skip;
-            outputL += skip;
-            outputR += skip;
+            frames -= count;
         }
     }
 
@@ -192,14 +205,8 @@ namespace Freeverb
             _gain = kFixedGain;
         }
 
-        for (i = 0; i < kNumCombs; i++)
-        {
-            _combL[i].SetFeedback(_roomSize1);
-            _combR[i].SetFeedback(_roomSize1);
-
-            _combL[i].SetDamp(_damp1);
-            _combR[i].SetDamp(_damp1);
-        }
+        _combs.SetFeedback(_roomSize1);
+        _combs.SetDamp(_damp1);
 
         _dirty = false;
     }
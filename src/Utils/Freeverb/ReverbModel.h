@@ -23,7 +23,7 @@
 #include <SparkyStudios/Audio/Amplitude/Core/Common.h>
 
 #include "AllPass.h"
-#include "Comb.h"
+#include "CombBank.h"
 
 #include "tuning.h"
 
@@ -73,8 +73,7 @@ namespace Freeverb
         // with its subsequent error-checking messiness
 
         // Comb filters
-        Comb _combL[kNumCombs];
-        Comb _combR[kNumCombs];
+        CombBank _combs;
 
         // Allpass filters
         AllPass _allPassL[kNumAllPasses];
@@ -43,11 +43,12 @@ namespace SparkyStudios::Audio::Amplitude
 
         for (AmSize i = 0; i < end; i += AmAudioFrame::size)
         {
-            const auto ba = xsimd::load_aligned(&a[i]);
-            const auto bb = xsimd::load_aligned(&b[i]);
+            // The convolver sums at any offset of its buffers.
+            const auto ba = xsimd::load_unaligned(&a[i]);
+            const auto bb = xsimd::load_unaligned(&b[i]);
 
             auto res = xsimd::add(ba, bb);
-            res.store_aligned(&result[i]);
+            res.store_unaligned(&result[i]);
         }
 
         for (AmSize i = end; i < len; i++)
@@ -154,6 +155,123 @@ namespace SparkyStudios::Audio::Amplitude
         std::memcpy(dest.GetBuffer(), src, srcSize * sizeof(AmReal32));
         std::memset(dest.GetBuffer() + srcSize, 0, (dest.GetSize() - srcSize) * sizeof(AmReal32));
     }
+
+    /**
+     * @brief Converts a normalized floating point sample into a signed 16-bit integer sample.
+     *
+     * This is the exact inverse of AmInt16ToReal32(), so samples converted from 16-bit integers
+     * are converted back to the same values. Samples outside the [-1, 1] range are clipped.
+     *
+     * @param x The sample to convert.
+     *
+     * @return The converted sample.
+     */
+    AM_INLINE(AmInt16) NarrowReal32ToInt16(const AmReal32 x)
+    {
+#if defined(AM_ACCURATE_CONVERSION)
+        const AmReal32 y = (x + 1.0f) * 32767.5f - 32768.0f; // -1..1 to -32768..32767
+#else
+        const AmReal32 y = x * 32768.0f; // -1..0.999969482421875 to -32768..32767
+#endif
+
+        return static_cast<AmInt16>(std::nearbyint(AM_CLAMP(y, -32768.0f, 32767.0f)));
+    }
+
+    /**
+     * @brief Converts signed 16-bit integer samples into normalized floating point samples.
+     *
+     * @param out The output buffer.
+     * @param in The input buffer.
+     * @param len The number of samples to convert.
+     */
+    AM_INLINE(void) ConvertInt16ToReal32(AmReal32* AM_RESTRICT out, const AmInt16* AM_RESTRICT in, const AmSize len)
+    {
+#if defined(AM_SIMD_INTRINSICS)
+        typedef xsimd::batch<AmInt32, AmAudioFrame::arch_type> AmInt32Frame;
+
+        const AmSize end = AmAudioFrame::size * (len / AmAudioFrame::size);
+
+#if defined(AM_ACCURATE_CONVERSION)
+        const AmAudioFrame offset(32768.0f), scale(0.00003051804379339284f), one(1.0f);
+#else
+        const AmAudioFrame scale(0.000030517578125f);
+#endif
+
+        alignas(AmAudioFrame::arch_type::alignment()) AmInt32 lanes[AmAudioFrame::size];
+
+        for (AmSize i = 0; i < end; i += AmAudioFrame::size)
+        {
+            for (AmSize j = 0; j < AmAudioFrame::size; ++j)
+                lanes[j] = in[i + j];
+
+#if defined(AM_ACCURATE_CONVERSION)
+            const auto res = (xsimd::to_float(AmInt32Frame::load_aligned(lanes)) + offset) * scale - one;
+#else
+            const auto res = xsimd::to_float(AmInt32Frame::load_aligned(lanes)) * scale;
+#endif
+            res.store_unaligned(&out[i]);
+        }
+
+        for (AmSize i = end; i < len; ++i)
+        {
+            out[i] = AmInt16ToReal32(in[i]);
+        }
+#else
+        for (AmSize i = 0; i < len; ++i)
+        {
+            out[i] = AmInt16ToReal32(in[i]);
+        }
+#endif
+    }
+
+    /**
+     * @brief Converts normalized floating point samples into signed 16-bit integer samples.
+     *
+     * This uses the same scale as ConvertInt16ToReal32(), so 16-bit samples survive a round trip
+     * unchanged. Samples outside the [-1, 1] range are clipped.
+     *
+     * @param out The output buffer.
+     * @param in The input buffer.
+     * @param len The number of samples to convert.
+     */
+    AM_INLINE(void) ConvertReal32ToInt16(AmInt16* AM_RESTRICT out, const AmReal32* AM_RESTRICT in, const AmSize len)
+    {
+#if defined(AM_SIMD_INTRINSICS)
+        const AmSize end = AmAudioFrame::size * (len / AmAudioFrame::size);
+        const AmAudioFrame minimum(-32768.0f), maximum(32767.0f);
+
+#if defined(AM_ACCURATE_CONVERSION)
+        const AmAudioFrame one(1.0f), scale(32767.5f), offset(32768.0f);
+#else
+        const AmAudioFrame scale(32768.0f);
+#endif
+
+        alignas(AmAudioFrame::arch_type::alignment()) AmInt32 lanes[AmAudioFrame::size];
+
+        for (AmSize i = 0; i < end; i += AmAudioFrame::size)
+        {
+#if defined(AM_ACCURATE_CONVERSION)
+            const auto res = (AmAudioFrame::load_unaligned(&in[i]) + one) * scale - offset;
+#else
+            const auto res = AmAudioFrame::load_unaligned(&in[i]) * scale;
+#endif
+            xsimd::to_int(xsimd::nearbyint(xsimd::clip(res, minimum, maximum))).store_aligned(lanes);
+
+            for (AmSize j = 0; j < AmAudioFrame::size; ++j)
+                out[i + j] = static_cast<AmInt16>(lanes[j]);
+        }
+
+        for (AmSize i = end; i < len; ++i)
+        {
+            out[i] = NarrowReal32ToInt16(in[i]);
+        }
+#else
+        for (AmSize i = 0; i < len; ++i)
+        {
+            out[i] = NarrowReal32ToInt16(in[i]);
+        }
+#endif
+    }
 } // namespace SparkyStudios::Audio::Amplitude
 
 #endif // SS_AMPLITUDE_AUDIO_UTILS_H
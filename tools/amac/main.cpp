@@ -12,7 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <unordered_map>
+#include <vector>
 
 #include <SparkyStudios/Audio/Amplitude/Amplitude.h>
 
@@ -21,6 +27,7 @@
 #include "../src/Core/Codecs/WAV/Codec.h"
 
 #include "../src/Utils/Audio/Resampling/CDSPResampler.h"
+#include "../src/Utils/Utils.h"
 
 #define AM_FLAG_NOISE_SHAPING 0x1
 
@@ -75,6 +82,26 @@ struct ProcessingState
         bool enabled = false;
         AmUInt32 targetSampleRate = 48000;
     } resampling;
+
+    /**
+     * @brief Configures the batch mode.
+     */
+    struct
+    {
+        bool enabled = false;
+
+        /**
+         * @brief The number of files processed in parallel. Uses all the
+         * available cores when set to 0.
+         */
+        AmUInt32 jobs = 0;
+
+        /**
+         * @brief Whether to skip the files which didn't change since the
+         * last run.
+         */
+        bool useCache = true;
+    } batch;
 };
 
 /**
@@ -92,12 +119,41 @@ static void log(const char* fmt, va_list args)
 #endif
 }
 
-static int process(const AmOsString& inFileName, const AmOsString& outFileName, const ProcessingState& state)
+/**
+ * @brief Collects information about a processed file.
+ */
+struct ProcessingStats
 {
-    AmInt32 res;
+    /**
+     * @brief The size in bytes of the input file.
+     */
+    AmSize inputSize = 0;
 
-    const auto inputFile = amEngine->GetFileSystem()->OpenFile(inFileName);
-    const auto outputFile = amEngine->GetFileSystem()->OpenFile(outFileName);
+    /**
+     * @brief The duration in seconds of the processed audio.
+     */
+    AmReal64 duration = 0.0;
+};
+
+/**
+ * @brief Opens a file on the disk in the given mode.
+ *
+ * @param fileName The path to the file.
+ * @param mode The file open mode.
+ */
+static std::shared_ptr<File> openFile(const AmOsString& fileName, FileOpenMode mode)
+{
+    return std::shared_ptr<DiskFile>(ampoolnew(MemoryPoolKind::IO, DiskFile, fileName, mode), am_delete<MemoryPoolKind::IO, DiskFile>{});
+}
+
+static int process(const AmOsString& inFileName, const AmOsString& outFileName, const ProcessingState& state, ProcessingStats& stats)
+{
+    const auto inputFile = openFile(inFileName, eFOM_READ);
+    if (!inputFile->IsValid())
+    {
+        fprintf(stderr, "Unable to open file \"" AM_OS_CHAR_FMT "\" for reading.\n", inFileName.c_str());
+        return EXIT_FAILURE;
+    }
 
     auto* ams_codec = Codec::Find("ams");
     auto* wav_codec = Codec::Find("wav");
@@ -115,6 +171,8 @@ static int process(const AmOsString& inFileName, const AmOsString& outFileName,
         auto* decoder = codec->CreateDecoder();
         if (!decoder->Open(inputFile))
         {
+            codec->DestroyDecoder(decoder);
+
             fprintf(
                 stderr, "Unable to load the input file: " AM_OS_CHAR_FMT ". The found codec (%s) was not able to open the input file.\n",
                 inFileName.c_str(), codec->GetName().c_str());
@@ -128,8 +186,6 @@ static int process(const AmOsString& inFileName, const AmOsString& outFileName,
         AmUInt64 numSamples = format.GetFramesCount();
         AmUInt64 framesSize = format.GetFrameSize();
 
-        auto* encoder = dynamic_cast<AMSCodec::AMSEncoder*>(ams_codec->CreateEncoder());
-
         if (state.blockSizeShift > 0)
             blockSize = 1 << state.blockSizeShift;
         else
@@ -150,44 +206,47 @@ static int process(const AmOsString& inFileName, const AmOsString& outFileName,
         if (decoder->Load(pcmData) != numSamples || !decoder->Close())
         {
             ampoolfree(MemoryPoolKind::Codec, pcmData);
+            codec->DestroyDecoder(decoder);
+
             fprintf(stderr, "Error while decoding PCM file \"" AM_OS_CHAR_FMT "\".\n", inFileName.c_str());
             return EXIT_FAILURE;
         }
 
-        encoder->SetEncodingParams(
-            blockSize, samplesPerBlock, state.lookAhead,
-            state.noiseShaping ? (sampleRate > 64000 ? Compression::ADPCM::eNSM_STATIC : Compression::ADPCM::eNSM_DYNAMIC)
-                               : Compression::ADPCM::eNSM_OFF);
+        codec->DestroyDecoder(decoder);
 
-        auto* output16 = static_cast<AmInt16Buffer>(
-            ampoolmalign(MemoryPoolKind::SoundData, numSamples * numChannels * sizeof(AmInt16), AM_SIMD_ALIGNMENT));
+        stats.inputSize = inputFile->Length();
+        stats.duration = static_cast<AmReal64>(numSamples) / sampleRate;
+
+        AmInt16Buffer output16;
+        SoundFormat encodeFormat = format;
 
         if (state.resampling.enabled)
         {
-            AmUInt64 f = std::ceil(static_cast<AmReal32>(numSamples * state.resampling.targetSampleRate) / sampleRate);
+            const auto maxFrames = static_cast<AmUInt64>(
+                std::ceil(static_cast<AmReal64>(numSamples) * state.resampling.targetSampleRate / sampleRate));
 
-            std::vector<r8b::CDSPResampler16*> resamplers;
-            for (AmUInt16 c = 0; c < numChannels; c++)
-                resamplers.push_back(new r8b::CDSPResampler16(sampleRate, state.resampling.targetSampleRate, numSamples));
+            output16 = static_cast<AmInt16Buffer>(
+                ampoolmalign(MemoryPoolKind::SoundData, maxFrames * numChannels * sizeof(AmInt16), AM_SIMD_ALIGNMENT));
 
             auto* input64 =
                 static_cast<AmReal64Buffer>(ampoolmalign(MemoryPoolKind::SoundData, numSamples * sizeof(AmReal64), AM_SIMD_ALIGNMENT));
 
+            // A single resampler is reused for all the channels, it is cleared between each of them.
+            r8b::CDSPResampler16 resampler(sampleRate, state.resampling.targetSampleRate, numSamples);
+
+            AmUInt64 f = 0;
+
             for (AmUInt16 c = 0; c < numChannels; c++)
             {
-                auto* resampler = static_cast<r8b::CDSPResampler16*>(resamplers[c]);
-
                 for (AmUInt64 i = 0; i < numSamples; i++)
-                {
                     input64[i] = static_cast<AmReal64>(pcmData[i * numChannels + c]);
-                }
 
                 AmReal64Buffer output = nullptr;
-                f = resampler->process(input64, numSamples, output);
-                resampler->clear();
+                f = AM_MIN(static_cast<AmUInt64>(resampler.process(input64, numSamples, output)), maxFrames);
+                resampler.clear();
 
                 for (AmUInt64 i = 0; i < f; i++)
-                    output16[i * numChannels + c] = AmReal32ToInt16(static_cast<AmReal32>(output[i]), true);
+                    output16[i * numChannels + c] = AmReal32ToInt16(static_cast<AmReal32>(output[i]));
             }
 
             ampoolfree(MemoryPoolKind::SoundData, input64);
@@ -195,77 +254,65 @@ static int process(const AmOsString& inFileName, const AmOsString& outFileName,
             sampleRate = state.resampling.targetSampleRate;
             numSamples = f;
 
-            SoundFormat encodeFormat{};
             encodeFormat.SetAll(sampleRate, numChannels, format.GetBitsPerSample(), numSamples, framesSize, AM_SAMPLE_FORMAT_INT);
+        }
+        else
+        {
+            output16 = static_cast<AmInt16Buffer>(
+                ampoolmalign(MemoryPoolKind::SoundData, numSamples * numChannels * sizeof(AmInt16), AM_SIMD_ALIGNMENT));
 
-            encoder->SetFormat(encodeFormat);
-            if (!encoder->Open(outputFile))
-            {
-                ampoolfree(MemoryPoolKind::SoundData, output16);
-
-                fprintf(stderr, "Unable to open file \"" AM_OS_CHAR_FMT "\" for writing.\n", outFileName.c_str());
-
-                return EXIT_FAILURE;
-            }
+            ConvertReal32ToInt16(output16, pcmData, numSamples * numChannels);
+        }
 
-            if (encoder->Write(output16, 0, numSamples) != numSamples || !encoder->Close())
-            {
-                ampoolfree(MemoryPoolKind::Codec, pcmData);
-                ampoolfree(MemoryPoolKind::SoundData, output16);
+        ampoolfree(MemoryPoolKind::Codec, pcmData);
 
-                fprintf(stderr, "Error while encoding ADPCM file \"" AM_OS_CHAR_FMT "\".\n", outFileName.c_str());
+        auto* encoder = dynamic_cast<AMSCodec::AMSEncoder*>(ams_codec->CreateEncoder());
 
-                return EXIT_FAILURE;
-            }
+        encoder->SetEncodingParams(
+            blockSize, samplesPerBlock, state.lookAhead,
+            state.noiseShaping ? (sampleRate > 64000 ? Compression::ADPCM::eNSM_STATIC : Compression::ADPCM::eNSM_DYNAMIC)
+                               : Compression::ADPCM::eNSM_OFF);
 
-            for (AmUInt16 c = 0; c < numChannels; c++)
-                delete resamplers[c];
-        }
-        else
+        encoder->SetFormat(encodeFormat);
+        if (!encoder->Open(openFile(outFileName, eFOM_WRITE)))
         {
-            for (int i = 0; i < numSamples * numChannels; ++i)
-                output16[i] = AmReal32ToInt16(pcmData[i], true);
+            ampoolfree(MemoryPoolKind::SoundData, output16);
+            ams_codec->DestroyEncoder(encoder);
 
-            encoder->SetFormat(format);
-            if (!encoder->Open(outputFile))
-            {
-                ampoolfree(MemoryPoolKind::SoundData, output16);
-                ampoolfree(MemoryPoolKind::Codec, pcmData);
-
-                fprintf(stderr, "Unable to open file \"" AM_OS_CHAR_FMT "\" for writing.\n", outFileName.c_str());
+            fprintf(stderr, "Unable to open file \"" AM_OS_CHAR_FMT "\" for writing.\n", outFileName.c_str());
 
-                return EXIT_FAILURE;
-            }
+            return EXIT_FAILURE;
+        }
 
-            if (encoder->Write(output16, 0, numSamples) != numSamples || !encoder->Close())
-            {
-                ampoolfree(MemoryPoolKind::SoundData, output16);
-                ampoolfree(MemoryPoolKind::Codec, pcmData);
+        if (encoder->Write(output16, 0, numSamples) != numSamples || !encoder->Close())
+        {
+            ampoolfree(MemoryPoolKind::SoundData, output16);
+            ams_codec->DestroyEncoder(encoder);
 
-                fprintf(stderr, "Error while encoding ADPCM file \"" AM_OS_CHAR_FMT "\".\n", outFileName.c_str());
+            fprintf(stderr, "Error while encoding ADPCM file \"" AM_OS_CHAR_FMT "\".\n", outFileName.c_str());
 
-                return EXIT_FAILURE;
-            }
+            return EXIT_FAILURE;
         }
 
         ampoolfree(MemoryPoolKind::SoundData, output16);
+        ams_codec->DestroyEncoder(encoder);
 
         if (state.verbose)
         {
             CallLogFunc("Operation completed successfully.\n");
         }
 
-        ampoolfree(MemoryPoolKind::Codec, pcmData);
-
-        res = EXIT_SUCCESS;
+        return EXIT_SUCCESS;
     }
-    else if (state.mode == ePM_DECODE)
+
+    if (state.mode == ePM_DECODE)
     {
         auto* decoder = ams_codec->CreateDecoder();
-        auto* encoder = wav_codec->CreateEncoder();
 
         if (!decoder->Open(inputFile))
         {
+            ams_codec->DestroyDecoder(decoder);
+
             fprintf(stderr, "Unable to open file \"" AM_OS_CHAR_FMT "\" for decoding.\n", inFileName.c_str());
             return EXIT_FAILURE;
         }
@@ -280,9 +327,14 @@ static int process(const AmOsString& inFileName, const AmOsString& outFileName,
             amsFormat.GetNumChannels() * sizeof(AmInt16), // Always decode in 16 bits signed integers
             AM_SAMPLE_FORMAT_INT);
 
+        auto* encoder = wav_codec->CreateEncoder();
+
         encoder->SetFormat(wavFormat);
-        if (!encoder->Open(outputFile))
+        if (!encoder->Open(openFile(outFileName, eFOM_WRITE)))
         {
+            ams_codec->DestroyDecoder(decoder);
+            wav_codec->DestroyEncoder(encoder);
+
             fprintf(stderr, "Unable to open file \"" AM_OS_CHAR_FMT "\" for encoding.\n", outFileName.c_str());
             return EXIT_FAILURE;
         }
@@ -294,43 +346,395 @@ static int process(const AmOsString& inFileName, const AmOsString& outFileName,
                 outFileName.c_str());
         }
 
-        AmUInt64 numSamples = decoder->GetFormat().GetFramesCount();
+        const AmUInt64 numSamples = amsFormat.GetFramesCount();
+        const AmUInt64 numChannels = amsFormat.GetNumChannels();
 
-        auto* adpcmData = static_cast<AmInt16Buffer>(ampoolmalloc(MemoryPoolKind::Codec, numSamples * decoder->GetFormat().GetFrameSize()));
+        stats.inputSize = inputFile->Length();
+        stats.duration = static_cast<AmReal64>(numSamples) / amsFormat.GetSampleRate();
 
-        if (decoder->Load(adpcmData) != numSamples || !decoder->Close())
+        // The AMS decoder outputs normalized float samples.
+        auto* pcmData = static_cast<AmAudioSampleBuffer>(ampoolmalloc(MemoryPoolKind::Codec, numSamples * amsFormat.GetFrameSize()));
+        auto* pcm16Data = static_cast<AmInt16Buffer>(ampoolmalloc(MemoryPoolKind::Codec, numSamples * numChannels * sizeof(AmInt16)));
+
+        if (decoder->Load(pcmData) != numSamples || !decoder->Close())
         {
-            ampoolfree(MemoryPoolKind::Codec, adpcmData);
+            ampoolfree(MemoryPoolKind::Codec, pcmData);
+            ampoolfree(MemoryPoolKind::Codec, pcm16Data);
+            ams_codec->DestroyDecoder(decoder);
+            wav_codec->DestroyEncoder(encoder);
+
             fprintf(stderr, "Error while decoding ADPCM file \"" AM_OS_CHAR_FMT "\".\n", inFileName.c_str());
             return EXIT_FAILURE;
         }
 
-        if (encoder->Write(adpcmData, 0, numSamples) != numSamples || !encoder->Close())
+        ConvertReal32ToInt16(pcm16Data, pcmData, numSamples * numChannels);
+
+        ampoolfree(MemoryPoolKind::Codec, pcmData);
+        ams_codec->DestroyDecoder(decoder);
+
+        if (encoder->Write(pcm16Data, 0, numSamples) != numSamples || !encoder->Close())
         {
-            ampoolfree(MemoryPoolKind::Codec, adpcmData);
+            ampoolfree(MemoryPoolKind::Codec, pcm16Data);
+            wav_codec->DestroyEncoder(encoder);
+
             fprintf(stderr, "Error while encoding PCM file \"" AM_OS_CHAR_FMT "\".\n", outFileName.c_str());
             return EXIT_FAILURE;
         }
 
+        ampoolfree(MemoryPoolKind::Codec, pcm16Data);
+        wav_codec->DestroyEncoder(encoder);
+
         if (state.verbose)
         {
             CallLogFunc("Operation completed successfully.\n");
         }
 
-        ampoolfree(MemoryPoolKind::Codec, adpcmData);
+        return EXIT_SUCCESS;
+    }
+
+    fprintf(stderr, "No encode/decode mode selected. Either add -e (encode) or -d (decode). Use -h for help.\n");
+    return EXIT_FAILURE;
+}
+
+/**
+ * @brief A file to process in batch mode.
+ */
+struct BatchJob
+{
+    /**
+     * @brief The path to the input file.
+     */
+    std::filesystem::path input;
+
+    /**
+     * @brief The path to the output file.
+     */
+    std::filesystem::path output;
+
+    /**
+     * @brief The path of the output file relative to the output directory. Used as the cache key.
+     */
+    std::string key;
+};
+
+/**
+ * @brief Stores the state shared by the batch workers.
+ */
+struct BatchState
+{
+    /**
+     * @brief The processing settings.
+     */
+    const ProcessingState* state = nullptr;
+
+    /**
+     * @brief The files to process.
+     */
+    std::vector<BatchJob> jobs;
+
+    /**
+     * @brief The index of the next job to pick.
+     */
+    std::atomic<AmSize> next = 0;
+
+    /**
+     * @brief The hash of the processing settings, used as the seed of the content hashes.
+     */
+    AmUInt64 settingsHash = 0;
+
+    /**
+     * @brief Protects the cache and the statistics.
+     */
+    AmMutexHandle mutex = nullptr;
+
+    /**
+     * @brief The content hashes of the inputs of the already processed files, indexed by cache key.
+     */
+    std::unordered_map<std::string, AmUInt64> cache;
+
+    AmUInt64 processed = 0;
+    AmUInt64 skipped = 0;
+    AmUInt64 failed = 0;
+
+    ProcessingStats stats;
+};
+
+/**
+ * @brief The name of the cache file, stored in the output directory.
+ */
+constexpr char kCacheFileName[] = ".amac_cache";
+
+/**
+ * @brief Bumped each time a change in this tool or in the AMS encoder makes previously encoded files stale.
+ */
+constexpr AmUInt32 kCacheVersion = 1;
+
+constexpr AmUInt64 kFNVOffsetBasis = 0xcbf29ce484222325ULL;
+constexpr AmUInt64 kFNVPrime = 0x100000001b3ULL;
+
+/**
+ * @brief Updates a 64-bit FNV-1a hash with the given data.
+ */
+static AmUInt64 hashBytes(AmConstVoidPtr data, AmSize size, AmUInt64 hash)
+{
+    const auto* bytes = static_cast<AmConstUInt8Buffer>(data);
+
+    for (AmSize i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= kFNVPrime;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Computes the hash of the processing settings.
+ */
+static AmUInt64 hashSettings(const ProcessingState& state)
+{
+    const AmUInt32 settings[] = {
+        kCacheVersion,
+        static_cast<AmUInt32>(state.mode),
+        state.lookAhead,
+        state.noiseShaping,
+        state.blockSizeShift,
+        state.resampling.enabled,
+        state.resampling.enabled ? state.resampling.targetSampleRate : 0,
+    };
+
+    return hashBytes(settings, sizeof(settings), kFNVOffsetBasis);
+}
+
+/**
+ * @brief Computes the hash of the content of the given file.
+ *
+ * @return Whether the file was read successfully.
+ */
+static bool hashFile(const std::filesystem::path& path, AmUInt64& hash)
+{
+    const auto file = openFile(path.native(), eFOM_READ);
+    if (!file->IsValid())
+        return false;
+
+    AmUInt8 buffer[65536];
+
+    AmSize read;
+    while ((read = file->Read(buffer, sizeof(buffer))) > 0)
+        hash = hashBytes(buffer, read, hash);
+
+    return true;
+}
+
+/**
+ * @brief Loads the cache file from the output directory, if any.
+ */
+static void loadCache(const std::filesystem::path& path, std::unordered_map<std::string, AmUInt64>& cache)
+{
+    std::ifstream file(path);
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+        const auto separator = line.find(' ');
+        if (separator == std::string::npos)
+            continue;
+
+        cache[line.substr(separator + 1)] = std::strtoull(line.substr(0, separator).c_str(), nullptr, 16);
+    }
+}
+
+/**
+ * @brief Saves the cache file into the output directory.
+ */
+static void saveCache(const std::filesystem::path& path, const std::unordered_map<std::string, AmUInt64>& cache)
+{
+    std::ofstream file(path, std::ios::trunc);
+
+    for (const auto& [key, hash] : cache)
+    {
+        char hex[17];
+        snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+
+        file << hex << ' ' << key << '\n';
+    }
+}
+
+/**
+ * @brief Checks whether the given file can be processed in the current mode.
+ */
+static bool isSupportedFile(const std::filesystem::path& path, const ProcessingState& state)
+{
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    if (state.mode == ePM_DECODE)
+        return extension == ".ams";
+
+    return extension == ".wav" || extension == ".mp3";
+}
+
+/**
+ * @brief Builds the list of files to process from a directory or a manifest file.
+ *
+ * A manifest is a text file listing one input file per line. Relative paths are resolved from the
+ * directory containing the manifest. Empty lines and lines starting with '#' are ignored.
+ *
+ * @return Whether the batch input was valid.
+ */
+static bool collectJobs(const std::filesystem::path& input, const std::filesystem::path& outputDir, BatchState& batch)
+{
+    const auto* extension = batch.state->mode == ePM_ENCODE ? ".ams" : ".wav";
+
+    const auto addJob = [&](const std::filesystem::path& file, std::filesystem::path relative)
+    {
+        relative.replace_extension(extension);
+        batch.jobs.push_back({ file, outputDir / relative, relative.generic_string() });
+    };
+
+    if (std::filesystem::is_directory(input))
+    {
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(input))
+        {
+            if (!entry.is_regular_file() || !isSupportedFile(entry.path(), *batch.state))
+                continue;
+
+            addJob(entry.path(), std::filesystem::relative(entry.path(), input));
+        }
+
+        return true;
+    }
+
+    std::ifstream manifest(input);
+    if (!manifest.is_open())
+        return false;
+
+    std::string line;
+    while (std::getline(manifest, line))
+    {
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        const std::filesystem::path file(line);
+
+        if (file.is_absolute())
+            addJob(file, file.filename());
+        else
+            addJob(input.parent_path() / file, file.lexically_normal());
+    }
+
+    return true;
+}
+
+static void batchWorker(AmVoidPtr param)
+{
+    auto* batch = static_cast<BatchState*>(param);
+
+    for (AmSize i = batch->next++; i < batch->jobs.size(); i = batch->next++)
+    {
+        const BatchJob& job = batch->jobs[i];
+
+        AmUInt64 hash = batch->settingsHash;
+        const bool hashed = hashFile(job.input, hash);
+
+        if (hashed && batch->state->batch.useCache)
+        {
+            Thread::LockMutex(batch->mutex);
+            const auto it = batch->cache.find(job.key);
+            const bool upToDate = it != batch->cache.end() && it->second == hash;
+            Thread::UnlockMutex(batch->mutex);
+
+            if (upToDate && std::filesystem::exists(job.output))
+            {
+                Thread::LockMutex(batch->mutex);
+                batch->skipped++;
+                Thread::UnlockMutex(batch->mutex);
+
+                continue;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(job.output.parent_path(), error);
+
+        ProcessingStats stats;
+        const bool succeeded = hashed && process(job.input.native(), job.output.native(), *batch->state, stats) == EXIT_SUCCESS;
+
+        Thread::LockMutex(batch->mutex);
 
-        delete decoder;
-        delete encoder;
+        if (succeeded)
+        {
+            batch->cache[job.key] = hash;
+            batch->processed++;
+            batch->stats.inputSize += stats.inputSize;
+            batch->stats.duration += stats.duration;
+        }
+        else
+        {
+            batch->cache.erase(job.key);
+            batch->failed++;
+        }
 
-        res = EXIT_SUCCESS;
+        Thread::UnlockMutex(batch->mutex);
     }
-    else
+}
+
+static int processBatch(const AmOsString& input, const AmOsString& outputDir, const ProcessingState& state)
+{
+    BatchState batch;
+    batch.state = &state;
+    batch.settingsHash = hashSettings(state);
+
+    if (!collectJobs(input, outputDir, batch))
     {
-        fprintf(stderr, "No encode/decode mode selected. Either add -e (encode) or -d (decode). Use -h for help.\n");
+        fprintf(
+            stderr, "Unable to read the batch input \"" AM_OS_CHAR_FMT "\". It should be a directory or a manifest file.\n",
+            input.c_str());
         return EXIT_FAILURE;
     }
 
-    return res;
+    std::error_code error;
+    std::filesystem::create_directories(outputDir, error);
+
+    const std::filesystem::path cacheFile = std::filesystem::path(outputDir) / kCacheFileName;
+    loadCache(cacheFile, batch.cache);
+
+    AmUInt32 threadCount = state.batch.jobs > 0 ? state.batch.jobs : std::thread::hardware_concurrency();
+    threadCount = AM_MAX(AM_MIN(threadCount, static_cast<AmUInt32>(batch.jobs.size())), 1u);
+
+    CallLogFunc("Processing %zu files with %u jobs...\n", batch.jobs.size(), threadCount);
+
+    batch.mutex = Thread::CreateMutex();
+
+    const AmUInt64 start = Thread::GetTimeMillis();
+
+    std::vector<AmThreadHandle> threads(threadCount);
+    for (auto& thread : threads)
+        thread = Thread::CreateThread(batchWorker, &batch);
+
+    for (const auto& thread : threads)
+    {
+        Thread::Wait(thread);
+        Thread::Release(thread);
+    }
+
+    const AmReal64 elapsed = AM_MAX(static_cast<AmReal64>(Thread::GetTimeMillis() - start) / 1000.0, 0.001);
+
+    Thread::DestroyMutex(batch.mutex);
+    batch.mutex = nullptr;
+
+    saveCache(cacheFile, batch.cache);
+
+    CallLogFunc(
+        "Processed %llu files, skipped %llu unchanged files, %llu failed in %.2f s.\n", static_cast<unsigned long long>(batch.processed),
+        static_cast<unsigned long long>(batch.skipped), static_cast<unsigned long long>(batch.failed), elapsed);
+    CallLogFunc(
+        "Throughput: %.1f files/s, %.2f MiB/s, %.1fx realtime.\n", batch.processed / elapsed,
+        batch.stats.inputSize / (1024.0 * 1024.0) / elapsed, batch.stats.duration / elapsed);
+
+    return batch.failed > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
 int main(int argc, char* argv[])
@@ -411,7 +815,7 @@ int main(int argc, char* argv[])
                 state.resampling.enabled = true;
                 state.resampling.targetSampleRate = strtol(argv[++i], argv, 10);
 
-                if (state.resampling.targetSampleRate < 8000 || state.blockSizeShift > 384000)
+                if (state.resampling.targetSampleRate < 8000 || state.resampling.targetSampleRate > 384000)
                 {
                     fprintf(stderr, "\nInvalid sample rate provided. Please give a value between 8000 and 384000.\n");
                     return EXIT_FAILURE;
@@ -423,6 +827,21 @@ int main(int argc, char* argv[])
                 state.mode = ePM_DECODE;
                 break;
 
+            case 'M':
+            case 'm':
+                state.batch.enabled = true;
+                break;
+
+            case 'J':
+            case 'j':
+                state.batch.jobs = strtol(argv[++i], argv, 10);
+                break;
+
+            case 'I':
+            case 'i':
+                state.batch.useCache = false;
+                break;
+
             default:
                 fprintf(stderr, "\nInvalid option: -%c. Use -h for help.\n", **argv);
                 return EXIT_FAILURE;
@@ -440,7 +859,6 @@ int main(int argc, char* argv[])
         }
         else if (!outFileName)
         {
-            std::cout << "out ";
             outFileName = static_cast<char*>(ampoolmalloc(MemoryPoolKind::Codec, strlen(argv[i]) + 10));
 
 #if defined(AM_WINDOWS_VERSION)
@@ -481,6 +899,7 @@ int main(int argc, char* argv[])
     {
         // clang-format off
         CallLogFunc("Usage: amac [OPTIONS] INPUT_FILE OUTPUT_FILE\n");
+        CallLogFunc("       amac [OPTIONS] -m INPUT_DIRECTORY|MANIFEST_FILE OUTPUT_DIRECTORY\n");
         CallLogFunc("\n");
         CallLogFunc("Global options:\n");
         CallLogFunc("    -[hH]:        \tDisplay this help message.\n");
@@ -500,12 +919,29 @@ int main(int argc, char* argv[])
         CallLogFunc("Decompression options:\n");
         CallLogFunc("    -[dD]:        \tDecompress the input file into the output file.\n");
         CallLogFunc("\n");
+        CallLogFunc("Batch options:\n");
+        CallLogFunc("    -[mM]:        \tBatch mode. The input is a directory or a manifest file listing one file per line,\n");
+        CallLogFunc("                  \tand the output is the directory where processed files are written.\n");
+        CallLogFunc("    -[jJ] count:  \tThe number of files processed in parallel.\n");
+        CallLogFunc("                  \tDefaults to the number of available cores.\n");
+        CallLogFunc("    -[iI]:        \tIgnore the cache and process all the files, even those which didn't change since the last run.\n");
+        CallLogFunc("\n");
         CallLogFunc("Example: amac -c -4 -b 12 input_pcm.wav output_adpcm.ams\n");
+        CallLogFunc("         amac -c -m -j 8 sounds/ build/sounds/\n");
         CallLogFunc("\n");
         // clang-format on
 
         return EXIT_SUCCESS;
     }
 
-    return process(AM_STRING_TO_OS_STRING(inFileName), AM_STRING_TO_OS_STRING(outFileName), state);
+    // The codecs used by this tool are registered on construction.
+    AMSCodec amsCodec;
+    MP3Codec mp3Codec;
+    WAVCodec wavCodec;
+
+    if (state.batch.enabled)
+        return processBatch(AM_STRING_TO_OS_STRING(inFileName), AM_STRING_TO_OS_STRING(outFileName), state);
+
+    ProcessingStats stats;
+    return process(AM_STRING_TO_OS_STRING(inFileName), AM_STRING_TO_OS_STRING(outFileName), state, stats);
 }
@@ -0,0 +1,1196 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdarg>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <flatbuffers/idl.h>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include "attenuation_definition_generated.h"
+#include "buses_definition_generated.h"
+#include "collection_definition_generated.h"
+#include "effect_definition_generated.h"
+#include "engine_config_definition_generated.h"
+#include "event_definition_generated.h"
+#include "rtpc_definition_generated.h"
+#include "sound_bank_definition_generated.h"
+#include "sound_definition_generated.h"
+#include "switch_container_definition_generated.h"
+#include "switch_definition_generated.h"
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+/**
+ * @brief The kinds of definition files found in a project.
+ */
+enum AssetKind
+{
+    eAK_ENGINE_CONFIG = 0,
+    eAK_BUSES,
+    eAK_RTPC,
+    eAK_EFFECT,
+    eAK_SWITCH,
+    eAK_ATTENUATION,
+    eAK_EVENT,
+    eAK_SOUND,
+    eAK_COLLECTION,
+    eAK_SWITCH_CONTAINER,
+    eAK_SOUND_BANK,
+    eAK_COUNT,
+};
+
+/**
+ * @brief Describes where the definition files of a kind are found, and how they are compiled.
+ */
+struct AssetKindInfo
+{
+    /**
+     * @brief The directory of the definition files, relative to the project root. Empty for files
+     * stored at the project root.
+     */
+    const char* directory;
+
+    /**
+     * @brief The suffix of the definition file names.
+     */
+    const char* suffix;
+
+    /**
+     * @brief The flatbuffers schema of the definition files.
+     */
+    const char* schema;
+
+    /**
+     * @brief Verifies a compiled binary of this kind.
+     */
+    bool (*verify)(flatbuffers::Verifier& verifier);
+};
+
+// clang-format off
+static constexpr AssetKindInfo kAssetKinds[eAK_COUNT] = {
+    { "",                  ".config.json", "engine_config_definition.fbs",    VerifyEngineConfigDefinitionBuffer    },
+    { "",                  ".buses.json",  "buses_definition.fbs",            VerifyBusDefinitionListBuffer         },
+    { "rtpc",              ".json",        "rtpc_definition.fbs",             VerifyRtpcDefinitionBuffer            },
+    { "effects",           ".json",        "effect_definition.fbs",           VerifyEffectDefinitionBuffer          },
+    { "switches",          ".json",        "switch_definition.fbs",           VerifySwitchDefinitionBuffer          },
+    { "attenuators",       ".json",        "attenuation_definition.fbs",      VerifyAttenuationDefinitionBuffer     },
+    { "events",            ".json",        "event_definition.fbs",            VerifyEventDefinitionBuffer           },
+    { "sounds",            ".json",        "sound_definition.fbs",            VerifySoundDefinitionBuffer           },
+    { "collections",       ".json",        "collection_definition.fbs",       VerifyCollectionDefinitionBuffer      },
+    { "switch_containers", ".json",        "switch_container_definition.fbs", VerifySwitchContainerDefinitionBuffer },
+    { "soundbanks",        ".json",        "sound_bank_definition.fbs",       VerifySoundBankDefinitionBuffer       },
+};
+// clang-format on
+
+/**
+ * @brief Stores the current process state.
+ */
+struct ProcessingState
+{
+    /**
+     * @brief Defines if the process is called in verbose mode.
+     */
+    bool verbose = false;
+
+    /**
+     * @brief The directory containing the flatbuffers schemas.
+     */
+    std::filesystem::path schemasDir;
+
+    /**
+     * @brief The path of the packed archive to write. No archive is written when empty.
+     */
+    std::filesystem::path archive;
+
+    /**
+     * @brief The number of files compiled in parallel. Uses all the available cores when set to 0.
+     */
+    AmUInt32 jobs = 0;
+
+    /**
+     * @brief Whether to skip the files which didn't change since the last run.
+     */
+    bool useCache = true;
+};
+
+/**
+ * @brief A definition file to compile.
+ */
+struct BuildJob
+{
+    /**
+     * @brief The kind of definition.
+     */
+    AssetKind kind;
+
+    /**
+     * @brief The path to the JSON definition file.
+     */
+    std::filesystem::path input;
+
+    /**
+     * @brief The path to the compiled binary file.
+     */
+    std::filesystem::path output;
+
+    /**
+     * @brief The path of the binary file relative to the output directory. Used as the cache key
+     * and as the entry name in the packed archive.
+     */
+    std::string key;
+
+    /**
+     * @brief The compiled binary data.
+     */
+    std::vector<AmUInt8> data;
+
+    /**
+     * @brief Whether the file has been compiled or loaded successfully.
+     */
+    bool valid = false;
+};
+
+/**
+ * @brief Stores the state shared by the build workers.
+ */
+struct BuildState
+{
+    /**
+     * @brief The processing settings.
+     */
+    const ProcessingState* state = nullptr;
+
+    /**
+     * @brief The directory where compiled files are written.
+     */
+    std::filesystem::path outputDir;
+
+    /**
+     * @brief The files to compile.
+     */
+    std::vector<BuildJob> jobs;
+
+    /**
+     * @brief The index of the next job to pick.
+     */
+    std::atomic<AmSize> next = 0;
+
+    /**
+     * @brief The hash of the schemas, used as the seed of the content hashes.
+     */
+    AmUInt64 schemasHash = 0;
+
+    /**
+     * @brief Protects the cache and the statistics.
+     */
+    AmMutexHandle mutex = nullptr;
+
+    /**
+     * @brief The content hashes of the already compiled files, indexed by cache key.
+     */
+    std::unordered_map<std::string, AmUInt64> cache;
+
+    AmUInt64 compiled = 0;
+    AmUInt64 skipped = 0;
+    AmUInt64 failed = 0;
+};
+
+/**
+ * @brief The name of the cache file, stored in the output directory.
+ */
+constexpr char kCacheFileName[] = ".ambc_cache";
+
+/**
+ * @brief Bumped each time a change in this tool makes previously compiled files stale.
+ */
+constexpr AmUInt32 kCacheVersion = 1;
+
+/**
+ * @brief The magic number and version of packed archives.
+ */
+constexpr char kArchiveMagic[4] = { 'A', 'M', 'P', 'K' };
+constexpr AmUInt32 kArchiveVersion = 1;
+
+/**
+ * @brief The alignment of the file data in packed archives.
+ */
+constexpr AmUInt64 kArchiveAlignment = 16;
+
+constexpr AmUInt64 kFNVOffsetBasis = 0xcbf29ce484222325ULL;
+constexpr AmUInt64 kFNVPrime = 0x100000001b3ULL;
+
+/**
+ * @brief The log function, used in verbose mode.
+ *
+ * @param fmt The message format.
+ * @param args The arguments.
+ */
+static void log(const char* fmt, va_list args)
+{
+#if defined(AM_WCHAR_SUPPORTED)
+    vfwprintf(stdout, AM_STRING_TO_OS_STRING(fmt), args);
+#else
+    vfprintf(stdout, fmt, args);
+#endif
+}
+
+/**
+ * @brief Updates a 64-bit FNV-1a hash with the given data.
+ */
+static AmUInt64 hashBytes(AmConstVoidPtr data, AmSize size, AmUInt64 hash)
+{
+    const auto* bytes = static_cast<AmConstUInt8Buffer>(data);
+
+    for (AmSize i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= kFNVPrime;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Reads the whole content of the given file.
+ *
+ * @return Whether the file was read successfully.
+ */
+static bool readFile(const std::filesystem::path& path, std::string& content)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    std::ostringstream stream;
+    stream << file.rdbuf();
+    content = stream.str();
+
+    return true;
+}
+
+/**
+ * @brief Computes the hash of all the schemas, so editing a schema rebuilds the whole project.
+ */
+static AmUInt64 hashSchemas(const std::filesystem::path& schemasDir)
+{
+    AmUInt64 hash = hashBytes(&kCacheVersion, sizeof(kCacheVersion), kFNVOffsetBasis);
+
+    std::vector<std::filesystem::path> schemas;
+    for (const auto& entry : std::filesystem::directory_iterator(schemasDir))
+        if (entry.is_regular_file() && entry.path().extension() == ".fbs")
+            schemas.push_back(entry.path());
+
+    // Hash the schemas in a stable order.
+    std::sort(schemas.begin(), schemas.end());
+
+    std::string content;
+    for (const auto& schema : schemas)
+        if (readFile(schema, content))
+            hash = hashBytes(content.data(), content.size(), hash);
+
+    return hash;
+}
+
+/**
+ * @brief Loads the cache file from the output directory, if any.
+ */
+static void loadCache(const std::filesystem::path& path, std::unordered_map<std::string, AmUInt64>& cache)
+{
+    std::ifstream file(path);
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+        const auto separator = line.find(' ');
+        if (separator == std::string::npos)
+            continue;
+
+        cache[line.substr(separator + 1)] = std::strtoull(line.substr(0, separator).c_str(), nullptr, 16);
+    }
+}
+
+/**
+ * @brief Saves the cache file into the output directory.
+ */
+static void saveCache(const std::filesystem::path& path, const std::unordered_map<std::string, AmUInt64>& cache)
+{
+    std::ofstream file(path, std::ios::trunc);
+
+    for (const auto& [key, hash] : cache)
+    {
+        char hex[17];
+        snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+
+        file << hex << ' ' << key << '\n';
+    }
+}
+
+/**
+ * @brief Checks whether the given file name ends with the given suffix.
+ */
+static bool endsWith(const std::string& name, const char* suffix)
+{
+    const AmSize length = std::strlen(suffix);
+    return name.size() > length && name.compare(name.size() - length, length, suffix) == 0;
+}
+
+/**
+ * @brief Builds the list of definition files to compile from the project directory.
+ */
+static void collectJobs(const std::filesystem::path& projectDir, const std::filesystem::path& outputDir, BuildState& build)
+{
+    for (AmUInt32 kind = 0; kind < eAK_COUNT; ++kind)
+    {
+        const AssetKindInfo& info = kAssetKinds[kind];
+        const std::filesystem::path directory = projectDir / info.directory;
+
+        if (!std::filesystem::is_directory(directory))
+            continue;
+
+        std::vector<std::filesystem::path> files;
+
+        // Files at the project root are not searched recursively, to not pick up the definitions of other kinds.
+        if (info.directory[0] == '\0')
+        {
+            for (const auto& entry : std::filesystem::directory_iterator(directory))
+                if (entry.is_regular_file() && endsWith(entry.path().filename().string(), info.suffix))
+                    files.push_back(entry.path());
+        }
+        else
+        {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+                if (entry.is_regular_file() && endsWith(entry.path().filename().string(), info.suffix))
+                    files.push_back(entry.path());
+        }
+
+        std::sort(files.begin(), files.end());
+
+        for (const auto& file : files)
+        {
+            BuildJob job;
+            job.kind = static_cast<AssetKind>(kind);
+            job.input = file;
+
+            // The final extension is given by the schema, it's set once the schema is loaded.
+            job.output = outputDir / std::filesystem::relative(file, projectDir);
+
+            build.jobs.push_back(std::move(job));
+        }
+    }
+}
+
+/**
+ * @brief Holds the schema parsers of a build worker.
+ *
+ * flatbuffers parsers are not thread-safe, each worker loads the schemas it needs once, and reuses
+ * them for all the files it compiles.
+ */
+class SchemaParsers
+{
+public:
+    explicit SchemaParsers(const std::filesystem::path& schemasDir)
+        : _schemasDir(schemasDir)
+        , _parsers()
+    {}
+
+    /**
+     * @brief Gets the parser of the given kind of definition, loading the schema if needed.
+     *
+     * @return The parser, or nullptr if the schema cannot be loaded.
+     */
+    flatbuffers::Parser* Get(AssetKind kind)
+    {
+        if (_parsers[kind] != nullptr)
+            return _parsers[kind].get();
+
+        const std::filesystem::path schemaPath = _schemasDir / kAssetKinds[kind].schema;
+
+        std::string schema;
+        if (!readFile(schemaPath, schema))
+        {
+            CallLogFunc("[ERROR] Unable to read the schema '%s'.\n", schemaPath.string().c_str());
+            return nullptr;
+        }
+
+        const std::string includeDir = _schemasDir.string();
+        const char* includeDirs[] = { includeDir.c_str(), nullptr };
+
+        auto parser = std::make_unique<flatbuffers::Parser>();
+        if (!parser->Parse(schema.c_str(), includeDirs, schemaPath.string().c_str()))
+        {
+            CallLogFunc("[ERROR] Unable to parse the schema '%s': %s\n", schemaPath.string().c_str(), parser->error_.c_str());
+            return nullptr;
+        }
+
+        _parsers[kind] = std::move(parser);
+        return _parsers[kind].get();
+    }
+
+private:
+    std::filesystem::path _schemasDir;
+    std::unique_ptr<flatbuffers::Parser> _parsers[eAK_COUNT];
+};
+
+/**
+ * @brief Compiles a JSON definition file into a flatbuffers binary.
+ *
+ * @param job The file to compile.
+ * @param parser The parser of the kind of the file.
+ * @param json The content of the JSON definition file.
+ *
+ * @return Whether the file was compiled successfully.
+ */
+static bool compile(BuildJob& job, flatbuffers::Parser& parser, const std::string& json)
+{
+    parser.builder_.Clear();
+
+    if (!parser.Parse(json.c_str(), nullptr, job.input.string().c_str()))
+    {
+        CallLogFunc("[ERROR] Unable to compile the file '%s': %s\n", job.input.string().c_str(), parser.error_.c_str());
+        return false;
+    }
+
+    const AmUInt8* buffer = parser.builder_.GetBufferPointer();
+    job.data.assign(buffer, buffer + parser.builder_.GetSize());
+
+    std::error_code error;
+    std::filesystem::create_directories(job.output.parent_path(), error);
+
+    std::ofstream file(job.output, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(job.data.data()), static_cast<std::streamsize>(job.data.size()));
+
+    if (!file.good())
+    {
+        CallLogFunc("[ERROR] Unable to write the file '%s'.\n", job.output.string().c_str());
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Verifies a binary loaded from a previous build.
+ *
+ * @return Whether the binary is a valid definition of the given kind.
+ */
+static bool verify(AssetKind kind, const std::string& data)
+{
+    flatbuffers::Verifier verifier(reinterpret_cast<const AmUInt8*>(data.data()), data.size());
+    return kAssetKinds[kind].verify(verifier);
+}
+
+static void buildWorker(AmVoidPtr param)
+{
+    auto* build = static_cast<BuildState*>(param);
+    SchemaParsers parsers(build->state->schemasDir);
+
+    for (AmSize i = build->next++; i < build->jobs.size(); i = build->next++)
+    {
+        BuildJob& job = build->jobs[i];
+
+        flatbuffers::Parser* parser = parsers.Get(job.kind);
+        if (parser == nullptr)
+        {
+            Thread::LockMutex(build->mutex);
+            build->failed++;
+            Thread::UnlockMutex(build->mutex);
+
+            continue;
+        }
+
+        job.output.replace_extension("." + parser->file_extension_);
+        job.key = job.output.lexically_relative(build->outputDir).generic_string();
+
+        // The file is read once, the same content is hashed and compiled.
+        std::string json;
+        if (!readFile(job.input, json))
+        {
+            CallLogFunc("[ERROR] Unable to read the file '%s'.\n", job.input.string().c_str());
+
+            Thread::LockMutex(build->mutex);
+            build->cache.erase(job.key);
+            build->failed++;
+            Thread::UnlockMutex(build->mutex);
+
+            continue;
+        }
+
+        const AmUInt64 hash = hashBytes(json.data(), json.size(), build->schemasHash);
+
+        if (build->state->useCache)
+        {
+            Thread::LockMutex(build->mutex);
+            const auto it = build->cache.find(job.key);
+            const bool upToDate = it != build->cache.end() && it->second == hash;
+            Thread::UnlockMutex(build->mutex);
+
+            // Unchanged files are loaded from the previous build, they are still needed to check references.
+            // The binary may have been altered since, it's compiled again when it doesn't verify.
+            std::string data;
+            if (upToDate && readFile(job.output, data) && verify(job.kind, data))
+            {
+                job.data.assign(data.begin(), data.end());
+                job.valid = true;
+
+                Thread::LockMutex(build->mutex);
+                build->skipped++;
+                Thread::UnlockMutex(build->mutex);
+
+                continue;
+            }
+        }
+
+        if (build->state->verbose)
+            CallLogFunc("Compiling '%s'...\n", job.input.string().c_str());
+
+        job.valid = compile(job, *parser, json);
+
+        Thread::LockMutex(build->mutex);
+
+        if (job.valid)
+        {
+            build->cache[job.key] = hash;
+            build->compiled++;
+        }
+        else
+        {
+            build->cache.erase(job.key);
+            build->failed++;
+        }
+
+        Thread::UnlockMutex(build->mutex);
+    }
+}
+
+/**
+ * @brief Checks the references between the compiled definitions.
+ */
+class ReferenceChecker
+{
+public:
+    explicit ReferenceChecker(const std::vector<BuildJob>& jobs)
+        : _jobs(jobs)
+        , _errors(0)
+    {
+        for (const BuildJob& job : _jobs)
+        {
+            if (!job.valid)
+                continue;
+
+            _paths.insert(job.key);
+        }
+    }
+
+    /**
+     * @brief Checks all the compiled definitions.
+     *
+     * @return The number of errors found.
+     */
+    AmUInt64 Check()
+    {
+        // Collect the IDs of all the objects first.
+        for (const BuildJob& job : _jobs)
+        {
+            if (!job.valid)
+                continue;
+
+            const AmConstVoidPtr data = job.data.data();
+
+            switch (job.kind)
+            {
+            case eAK_BUSES:
+                // Each platform can have its own buses file, so bus IDs are not unique across files.
+                if (const auto* buses = GetBusDefinitionList(data)->buses(); buses != nullptr)
+                    for (flatbuffers::uoffset_t i = 0; i < buses->size(); ++i)
+                        _ids[eAK_BUSES].insert(buses->Get(i)->id());
+                break;
+            case eAK_RTPC:
+                AddId(job, job.kind, GetRtpcDefinition(data)->id());
+                break;
+            case eAK_EFFECT:
+                AddId(job, job.kind, GetEffectDefinition(data)->id());
+                break;
+            case eAK_SWITCH:
+                {
+                    const SwitchDefinition* definition = GetSwitchDefinition(data);
+                    AddId(job, job.kind, definition->id());
+
+                    auto& states = _switchStates[definition->id()];
+                    if (definition->states() != nullptr)
+                        for (flatbuffers::uoffset_t i = 0; i < definition->states()->size(); ++i)
+                            states.insert(definition->states()->Get(i)->id());
+                }
+                break;
+            case eAK_ATTENUATION:
+                AddId(job, job.kind, GetAttenuationDefinition(data)->id());
+                break;
+            case eAK_EVENT:
+                AddId(job, job.kind, GetEventDefinition(data)->id());
+                break;
+            case eAK_SOUND:
+                AddId(job, job.kind, GetSoundDefinition(data)->id());
+                break;
+            case eAK_COLLECTION:
+                AddId(job, job.kind, GetCollectionDefinition(data)->id());
+                break;
+            case eAK_SWITCH_CONTAINER:
+                AddId(job, job.kind, GetSwitchContainerDefinition(data)->id());
+                break;
+            case eAK_SOUND_BANK:
+                AddId(job, job.kind, GetSoundBankDefinition(data)->id());
+                break;
+            default:
+                break;
+            }
+        }
+
+        for (const BuildJob& job : _jobs)
+        {
+            if (!job.valid)
+                continue;
+
+            const AmConstVoidPtr data = job.data.data();
+
+            switch (job.kind)
+            {
+            case eAK_ENGINE_CONFIG:
+                CheckEngineConfig(job, GetEngineConfigDefinition(data));
+                break;
+            case eAK_SOUND:
+                CheckSound(job, GetSoundDefinition(data));
+                break;
+            case eAK_COLLECTION:
+                CheckCollection(job, GetCollectionDefinition(data));
+                break;
+            case eAK_SWITCH_CONTAINER:
+                CheckSwitchContainer(job, GetSwitchContainerDefinition(data));
+                break;
+            case eAK_EVENT:
+                CheckEvent(job, GetEventDefinition(data));
+                break;
+            case eAK_SOUND_BANK:
+                CheckSoundBank(job, GetSoundBankDefinition(data));
+                break;
+            default:
+                break;
+            }
+        }
+
+        return _errors;
+    }
+
+private:
+    void Error(const BuildJob& job, const char* fmt, ...)
+    {
+        char message[1024];
+
+        va_list args;
+        va_start(args, fmt);
+        vsnprintf(message, sizeof(message), fmt, args);
+        va_end(args);
+
+        fprintf(stderr, "[ERROR] %s: %s\n", job.input.string().c_str(), message);
+        _errors++;
+    }
+
+    void AddId(const BuildJob& job, AssetKind kind, AmObjectID id)
+    {
+        if (id == kAmInvalidObjectId)
+        {
+            Error(job, "Invalid ID.");
+            return;
+        }
+
+        if (!_ids[kind].insert(id).second)
+            Error(job, "Duplicate ID %llu.", static_cast<unsigned long long>(id));
+    }
+
+    bool HasId(AssetKind kind, AmObjectID id) const
+    {
+        return _ids[kind].contains(id);
+    }
+
+    void CheckReference(const BuildJob& job, AssetKind kind, AmObjectID id, const char* name, bool optional)
+    {
+        if (id == kAmInvalidObjectId)
+        {
+            if (!optional)
+                Error(job, "Missing %s ID.", name);
+
+            return;
+        }
+
+        if (!HasId(kind, id))
+            Error(job, "Unknown %s ID %llu.", name, static_cast<unsigned long long>(id));
+    }
+
+    void CheckEngineConfig(const BuildJob& job, const EngineConfigDefinition* definition)
+    {
+        if (const auto* busesFile = definition->buses_file(); busesFile != nullptr && !_paths.contains(busesFile->str()))
+            Error(job, "Unknown buses file '%s'.", busesFile->c_str());
+    }
+
+    void CheckSound(const BuildJob& job, const SoundDefinition* definition)
+    {
+        CheckReference(job, eAK_BUSES, definition->bus(), "bus", false);
+        CheckReference(job, eAK_EFFECT, definition->effect(), "effect", true);
+        CheckReference(job, eAK_ATTENUATION, definition->attenuation(), "attenuation", true);
+    }
+
+    void CheckCollection(const BuildJob& job, const CollectionDefinition* definition)
+    {
+        CheckReference(job, eAK_BUSES, definition->bus(), "bus", false);
+        CheckReference(job, eAK_EFFECT, definition->effect(), "effect", true);
+        CheckReference(job, eAK_ATTENUATION, definition->attenuation(), "attenuation", true);
+
+        if (definition->sounds() == nullptr)
+            return;
+
+        // All the collection entry types start with the sound ID.
+        for (flatbuffers::uoffset_t i = 0; i < definition->sounds()->size(); ++i)
+            CheckReference(job, eAK_SOUND, definition->sounds()->GetAs<DefaultCollectionEntry>(i)->sound(), "sound", false);
+    }
+
+    void CheckSwitchContainer(const BuildJob& job, const SwitchContainerDefinition* definition)
+    {
+        CheckReference(job, eAK_BUSES, definition->bus(), "bus", false);
+        CheckReference(job, eAK_EFFECT, definition->effect(), "effect", true);
+        CheckReference(job, eAK_ATTENUATION, definition->attenuation(), "attenuation", true);
+        CheckReference(job, eAK_SWITCH, definition->switch_group(), "switch", false);
+
+        const auto states = _switchStates.find(definition->switch_group());
+
+        const auto checkState = [&](AmObjectID state)
+        {
+            if (states != _switchStates.end() && !states->second.contains(state))
+                Error(job, "Unknown switch state ID %llu.", static_cast<unsigned long long>(state));
+        };
+
+        checkState(definition->default_switch_state());
+
+        if (definition->entries() == nullptr)
+            return;
+
+        for (flatbuffers::uoffset_t i = 0; i < definition->entries()->size(); ++i)
+        {
+            const SwitchContainerEntry* entry = definition->entries()->Get(i);
+
+            if (!HasId(eAK_SOUND, entry->object()) && !HasId(eAK_COLLECTION, entry->object()))
+                Error(
+                    job, "Unknown sound object ID %llu. It's neither a Sound nor a Collection.",
+                    static_cast<unsigned long long>(entry->object()));
+
+            for (flatbuffers::uoffset_t j = 0; j < entry->switch_states()->size(); ++j)
+                checkState(entry->switch_states()->Get(j));
+        }
+    }
+
+    void CheckEvent(const BuildJob& job, const EventDefinition* definition)
+    {
+        if (definition->actions() == nullptr)
+            return;
+
+        for (flatbuffers::uoffset_t i = 0; i < definition->actions()->size(); ++i)
+        {
+            const EventActionDefinition* action = definition->actions()->Get(i);
+            if (action->targets() == nullptr)
+                continue;
+
+            const bool targetsBuses = action->type() == EventActionType_MuteBus || action->type() == EventActionType_UnmuteBus;
+
+            for (flatbuffers::uoffset_t j = 0; j < action->targets()->size(); ++j)
+            {
+                const AmObjectID target = action->targets()->Get(j);
+
+                if (targetsBuses)
+                    CheckReference(job, eAK_BUSES, target, "bus", false);
+                else if (!HasId(eAK_SOUND, target) && !HasId(eAK_COLLECTION, target) && !HasId(eAK_SWITCH_CONTAINER, target))
+                    Error(job, "Unknown sound object ID %llu.", static_cast<unsigned long long>(target));
+            }
+        }
+    }
+
+    void CheckSoundBank(const BuildJob& job, const SoundBankDefinition* definition)
+    {
+        const auto checkFiles = [&](const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>* files, AssetKind kind)
+        {
+            if (files == nullptr)
+                return;
+
+            for (flatbuffers::uoffset_t i = 0; i < files->size(); ++i)
+            {
+                const std::string path = std::string(kAssetKinds[kind].directory) + "/" + files->Get(i)->str();
+
+                if (!_paths.contains(path))
+                    Error(job, "Unknown file '%s'.", path.c_str());
+            }
+        };
+
+        checkFiles(definition->rtpc(), eAK_RTPC);
+        checkFiles(definition->effects(), eAK_EFFECT);
+        checkFiles(definition->switches(), eAK_SWITCH);
+        checkFiles(definition->attenuators(), eAK_ATTENUATION);
+        checkFiles(definition->events(), eAK_EVENT);
+        checkFiles(definition->sounds(), eAK_SOUND);
+        checkFiles(definition->collections(), eAK_COLLECTION);
+        checkFiles(definition->switch_containers(), eAK_SWITCH_CONTAINER);
+    }
+
+    const std::vector<BuildJob>& _jobs;
+    AmUInt64 _errors;
+
+    std::unordered_set<std::string> _paths;
+    std::unordered_set<AmObjectID> _ids[eAK_COUNT];
+    std::unordered_map<AmSwitchID, std::unordered_set<AmObjectID>> _switchStates;
+};
+
+/**
+ * @brief Writes all the compiled definitions into a single archive.
+ *
+ * The archive starts with the "AMPK" magic number, the format version and the number of files, all
+ * as 32-bit little endian integers. It's followed by the table of contents, which stores for each
+ * file the 32-bit length of its path, its path relative to the output directory, and the 64-bit offset and
+ * size of its data. The data of each file is aligned on 16 bytes.
+ *
+ * @return Whether the archive was written successfully.
+ */
+static bool writeArchive(const std::filesystem::path& path, const std::vector<BuildJob>& jobs)
+{
+    struct Entry
+    {
+        std::string path;
+        const BuildJob* job;
+        AmUInt64 offset;
+    };
+
+    std::vector<Entry> entries;
+    AmUInt64 tocSize = sizeof(kArchiveMagic) + 2 * sizeof(AmUInt32);
+
+    for (const BuildJob& job : jobs)
+    {
+        Entry entry = { job.key, &job, 0 };
+        tocSize += sizeof(AmUInt32) + entry.path.size() + 2 * sizeof(AmUInt64);
+        entries.push_back(std::move(entry));
+    }
+
+    const auto align = [](AmUInt64 offset)
+    {
+        return (offset + kArchiveAlignment - 1) & ~(kArchiveAlignment - 1);
+    };
+
+    AmUInt64 offset = align(tocSize);
+    for (Entry& entry : entries)
+    {
+        entry.offset = offset;
+        offset = align(offset + entry.job->data.size());
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        return false;
+
+    const auto writeInt = [&file](auto value)
+    {
+        // Integers are stored in little endian.
+        AmUInt8 bytes[sizeof(value)];
+        for (AmSize i = 0; i < sizeof(value); ++i)
+            bytes[i] = static_cast<AmUInt8>(value >> (i * 8));
+
+        file.write(reinterpret_cast<const char*>(bytes), sizeof(bytes));
+    };
+
+    const auto pad = [&file, &align]()
+    {
+        const auto position = static_cast<AmUInt64>(file.tellp());
+        for (AmUInt64 i = position; i < align(position); ++i)
+            file.put(0);
+    };
+
+    file.write(kArchiveMagic, sizeof(kArchiveMagic));
+    writeInt(kArchiveVersion);
+    writeInt(static_cast<AmUInt32>(entries.size()));
+
+    for (const Entry& entry : entries)
+    {
+        writeInt(static_cast<AmUInt32>(entry.path.size()));
+        file.write(entry.path.data(), static_cast<std::streamsize>(entry.path.size()));
+        writeInt(entry.offset);
+        writeInt(static_cast<AmUInt64>(entry.job->data.size()));
+    }
+
+    for (const Entry& entry : entries)
+    {
+        pad();
+        file.write(reinterpret_cast<const char*>(entry.job->data.data()), static_cast<std::streamsize>(entry.job->data.size()));
+    }
+
+    return file.good();
+}
+
+static int compileProject(const std::filesystem::path& projectDir, const std::filesystem::path& outputDir, const ProcessingState& state)
+{
+    if (!std::filesystem::is_directory(projectDir))
+    {
+        fprintf(stderr, "The project directory \"%s\" doesn't exist.\n", projectDir.string().c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (!std::filesystem::is_directory(state.schemasDir))
+    {
+        fprintf(stderr, "The schemas directory \"%s\" doesn't exist. Use -s to set it.\n", state.schemasDir.string().c_str());
+        return EXIT_FAILURE;
+    }
+
+    BuildState build;
+    build.state = &state;
+    build.outputDir = outputDir;
+    build.schemasHash = hashSchemas(state.schemasDir);
+
+    collectJobs(projectDir, outputDir, build);
+
+    std::error_code error;
+    std::filesystem::create_directories(outputDir, error);
+
+    const std::filesystem::path cacheFile = outputDir / kCacheFileName;
+    loadCache(cacheFile, build.cache);
+
+    AmUInt32 threadCount = state.jobs > 0 ? state.jobs : std::thread::hardware_concurrency();
+    threadCount = AM_MAX(AM_MIN(threadCount, static_cast<AmUInt32>(build.jobs.size())), 1u);
+
+    CallLogFunc("Compiling %zu definitions with %u jobs...\n", build.jobs.size(), threadCount);
+
+    build.mutex = Thread::CreateMutex();
+
+    const AmUInt64 start = Thread::GetTimeMillis();
+
+    std::vector<AmThreadHandle> threads(threadCount);
+    for (auto& thread : threads)
+        thread = Thread::CreateThread(buildWorker, &build);
+
+    for (const auto& thread : threads)
+    {
+        Thread::Wait(thread);
+        Thread::Release(thread);
+    }
+
+    Thread::DestroyMutex(build.mutex);
+    build.mutex = nullptr;
+
+    saveCache(cacheFile, build.cache);
+
+    ReferenceChecker checker(build.jobs);
+    const AmUInt64 errors = checker.Check();
+
+    const AmReal64 elapsed = AM_MAX(static_cast<AmReal64>(Thread::GetTimeMillis() - start) / 1000.0, 0.001);
+
+    CallLogFunc(
+        "Compiled %llu definitions, skipped %llu unchanged definitions, %llu failed in %.2f s.\n",
+        static_cast<unsigned long long>(build.compiled), static_cast<unsigned long long>(build.skipped),
+        static_cast<unsigned long long>(build.failed), elapsed);
+
+    if (build.failed > 0)
+        fprintf(stderr, "%llu definitions failed to compile.\n", static_cast<unsigned long long>(build.failed));
+
+    if (errors > 0)
+        fprintf(stderr, "The project has %llu invalid references.\n", static_cast<unsigned long long>(errors));
+
+    if (build.failed > 0 || errors > 0)
+        return EXIT_FAILURE;
+
+    if (!state.archive.empty())
+    {
+        if (!writeArchive(state.archive, build.jobs))
+        {
+            fprintf(stderr, "Unable to write the archive \"%s\".\n", state.archive.string().c_str());
+            return EXIT_FAILURE;
+        }
+
+        CallLogFunc("Packed %zu definitions into '%s'.\n", build.jobs.size(), state.archive.string().c_str());
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char* argv[])
+{
+    MemoryManager::Initialize(MemoryManagerConfig());
+
+    const char *projectDir = nullptr, *outputDir = nullptr;
+    bool noLogo = false, needHelp = false;
+    ProcessingState state;
+
+    if (const char* sdkPath = std::getenv("AM_SDK_PATH"); sdkPath != nullptr)
+        state.schemasDir = std::filesystem::path(sdkPath) / "schemas";
+    else
+        state.schemasDir = "schemas";
+
+    for (int i = 1; i < argc; i++)
+    {
+#if defined(AM_WINDOWS_VERSION)
+        if (*argv[i] == '-' || *argv[i] == '/')
+#else
+        if (*argv[i] == '-')
+#endif // AM_WINDOWS_VERSION
+        {
+            switch (argv[i][1])
+            {
+            case 'H':
+            case 'h':
+                needHelp = true;
+                state.verbose = true;
+                break;
+
+            case 'O':
+            case 'o':
+                noLogo = true;
+                break;
+
+            case 'Q':
+            case 'q':
+                state.verbose = false;
+                noLogo = true;
+                break;
+
+            case 'V':
+            case 'v':
+                state.verbose = true;
+                break;
+
+            case 'S':
+            case 's':
+                if (++i >= argc)
+                {
+                    fprintf(stderr, "\nMissing schemas directory. Use -h for help.\n");
+                    return EXIT_FAILURE;
+                }
+
+                state.schemasDir = argv[i];
+                break;
+
+            case 'A':
+            case 'a':
+                if (++i >= argc)
+                {
+                    fprintf(stderr, "\nMissing archive path. Use -h for help.\n");
+                    return EXIT_FAILURE;
+                }
+
+                state.archive = argv[i];
+                break;
+
+            case 'J':
+            case 'j':
+                if (++i >= argc)
+                {
+                    fprintf(stderr, "\nMissing jobs count. Use -h for help.\n");
+                    return EXIT_FAILURE;
+                }
+
+                state.jobs = strtol(argv[i], nullptr, 10);
+                break;
+
+            case 'I':
+            case 'i':
+                state.useCache = false;
+                break;
+
+            default:
+                fprintf(stderr, "\nInvalid option: %s. Use -h for help.\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (!projectDir)
+        {
+            projectDir = argv[i];
+        }
+        else if (!outputDir)
+        {
+            outputDir = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "\nUnknown extra argument: %s !\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!projectDir || !outputDir)
+    {
+        needHelp = true;
+    }
+
+    if (state.verbose || !noLogo || needHelp)
+    {
+        RegisterLogFunc(log);
+    }
+
+    if (!noLogo)
+    {
+        // clang-format off
+        CallLogFunc("\n");
+        CallLogFunc("Amplitude Bank Compiler (ambc)\n");
+        CallLogFunc("Copyright (c) 2021-present Sparky Studios - Licensed under Apache 2.0\n");
+        CallLogFunc("=====================================================================\n");
+        CallLogFunc("\n");
+        // clang-format on
+    }
+
+    if (needHelp)
+    {
+        // clang-format off
+        CallLogFunc("Usage: ambc [OPTIONS] PROJECT_DIRECTORY OUTPUT_DIRECTORY\n");
+        CallLogFunc("\n");
+        CallLogFunc("Compiles all the JSON definitions of an Amplitude project into flatbuffers binaries,\n");
+        CallLogFunc("and checks the references between them.\n");
+        CallLogFunc("\n");
+        CallLogFunc("Global options:\n");
+        CallLogFunc("    -[hH]:        \tDisplay this help message.\n");
+        CallLogFunc("    -[oO]:        \tHide logo and copyright notice.\n");
+        CallLogFunc("    -[qQ]:        \tQuiet mode. Shutdown all messages.\n");
+        CallLogFunc("    -[vV]:        \tVerbose mode. Display all messages.\n");
+        CallLogFunc("\n");
+        CallLogFunc("Build options:\n");
+        CallLogFunc("    -[sS] path:   \tThe directory containing the Amplitude schemas.\n");
+        CallLogFunc("                  \tDefaults to $AM_SDK_PATH/schemas.\n");
+        CallLogFunc("    -[aA] path:   \tAlso pack all the compiled definitions into a single archive.\n");
+        CallLogFunc("    -[jJ] count:  \tThe number of files compiled in parallel.\n");
+        CallLogFunc("                  \tDefaults to the number of available cores.\n");
+        CallLogFunc("    -[iI]:        \tIgnore the cache and compile all the files, even those which didn't change since the last run.\n");
+        CallLogFunc("\n");
+        CallLogFunc("Example: ambc -j 8 samples/rawassets samples/assets\n");
+        CallLogFunc("         ambc -a build/project.ampk samples/rawassets build/assets\n");
+        CallLogFunc("\n");
+        // clang-format on
+
+        return EXIT_SUCCESS;
+    }
+
+    return compileProject(projectDir, outputDir, state);
+}
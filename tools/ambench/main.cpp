@@ -0,0 +1,430 @@
+// Copyright (c) 2021-present Sparky Studios. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <SparkyStudios/Audio/Amplitude/Amplitude.h>
+
+#include "../src/Sound/Filters/BiquadResonantFilter.h"
+#include "../src/Sound/Filters/DCRemovalFilter.h"
+#include "../src/Sound/Filters/DelayFilter.h"
+#include "../src/Sound/Filters/FreeverbFilter.h"
+#include "../src/Sound/Filters/LofiFilter.h"
+#include "../src/Sound/Filters/WaveShaperFilter.h"
+
+#include "../src/Utils/Freeverb/CombBank.h"
+
+using namespace SparkyStudios::Audio::Amplitude;
+
+/**
+ * @brief Stores the current benchmark settings.
+ */
+struct BenchmarkState
+{
+    /**
+     * @brief The number of frames processed per block.
+     */
+    AmUInt32 frames = 512;
+
+    /**
+     * @brief The number of interleaved channels in each block.
+     */
+    AmUInt16 channels = 2;
+
+    /**
+     * @brief The sample rate of the processed audio.
+     */
+    AmUInt32 sampleRate = 48000;
+
+    /**
+     * @brief The duration of audio processed by each benchmark, in seconds.
+     */
+    AmReal64 duration = 60.0;
+
+    /**
+     * @brief The names of the benchmarks to run. All of them run when empty.
+     */
+    std::vector<std::string> names;
+};
+
+/**
+ * @brief A benchmark, running a block of audio through the measured code.
+ */
+struct Benchmark
+{
+    /**
+     * @brief The name of the benchmark.
+     */
+    const char* name;
+
+    /**
+     * @brief Creates the state of the benchmark, and returns the function processing a block in place.
+     *
+     * The processing function receives the buffer, and whether the parameters should change in this block.
+     */
+    std::function<std::function<void(AmAudioSampleBuffer, bool)>(const BenchmarkState&)> setup;
+};
+
+/**
+ * @brief The log function.
+ *
+ * @param fmt The message format.
+ * @param args The arguments.
+ */
+static void log(const char* fmt, va_list args)
+{
+#if defined(AM_WCHAR_SUPPORTED)
+    vfwprintf(stdout, AM_STRING_TO_OS_STRING(fmt), args);
+#else
+    vfprintf(stdout, fmt, args);
+#endif
+}
+
+/**
+ * @brief Creates a benchmark running a filter with the given parameters.
+ *
+ * When the parameters change, the wet level of the filter alternates between 1 and 0.5, so
+ * that the filter ramps its parameters over the block.
+ *
+ * @param filter The filter to run.
+ * @param parameters The index and value of each parameter to set before running the filter.
+ *
+ * @return The benchmark setup function.
+ */
+static auto filterBenchmark(Filter* filter, std::vector<std::pair<AmUInt32, AmReal32>> parameters)
+{
+    return [filter, parameters](const BenchmarkState& state) -> std::function<void(AmAudioSampleBuffer, bool)>
+    {
+        std::shared_ptr<FilterInstance> instance(
+            filter->CreateInstance(),
+            [filter](FilterInstance* instance)
+            {
+                filter->DestroyInstance(instance);
+            });
+
+        for (auto&& [id, value] : parameters)
+            instance->SetFilterParameter(id, value);
+
+        return [instance, state, toggle = false](AmAudioSampleBuffer buffer, bool change) mutable
+        {
+            if (change)
+            {
+                toggle = !toggle;
+                instance->SetFilterParameter(0, toggle ? 0.5f : 1.0f);
+            }
+
+            instance->Process(buffer, state.frames, state.frames * state.channels, state.channels, state.sampleRate);
+        };
+    };
+}
+
+/**
+ * @brief Creates the state of the benchmark running the comb filters of the Freeverb model.
+ *
+ * The channels of each block are mixed into the mono input of the combs, and the outputs of the
+ * left and right combs are written back to the first two channels. When the parameters change,
+ * the room size alternates between its initial value and 0.9.
+ *
+ * @param state The benchmark settings.
+ *
+ * @return The function processing a block.
+ */
+static std::function<void(AmAudioSampleBuffer, bool)> combBankBenchmark(const BenchmarkState& state)
+{
+    using Freeverb::CombBank;
+
+    constexpr AmInt32 kTunings[CombBank::kLanesCount] = {
+        kCombTuningL1, kCombTuningL2, kCombTuningL3, kCombTuningL4, kCombTuningL5, kCombTuningL6, kCombTuningL7, kCombTuningL8,
+        kCombTuningR1, kCombTuningR2, kCombTuningR3, kCombTuningR4, kCombTuningR5, kCombTuningR6, kCombTuningR7, kCombTuningR8,
+    };
+
+    struct Combs
+    {
+        CombBank bank;
+        std::vector<AmReal32> buffers[CombBank::kLanesCount];
+    };
+
+    auto combs = std::make_shared<Combs>();
+
+    for (AmUInt32 l = 0; l < CombBank::kLanesCount; ++l)
+    {
+        combs->buffers[l].assign(kTunings[l], 0.0f);
+        combs->bank.SetBuffer(l, combs->buffers[l].data(), kTunings[l]);
+    }
+
+    combs->bank.SetDamp(kInitialDamp * kScaleDamp);
+    combs->bank.SetFeedback(kInitialRoom * kScaleRoom + kOffsetRoom);
+
+    return [combs, state, toggle = false](AmAudioSampleBuffer buffer, bool change) mutable
+    {
+        if (change)
+        {
+            toggle = !toggle;
+            combs->bank.SetFeedback((toggle ? 0.9f : kInitialRoom) * kScaleRoom + kOffsetRoom);
+        }
+
+        AmReal32 input[CombBank::kBlockFrames];
+        AmReal32 left[CombBank::kBlockFrames];
+        AmReal32 right[CombBank::kBlockFrames];
+
+        for (AmUInt32 offset = 0; offset < state.frames; offset += CombBank::kBlockFrames)
+        {
+            const AmUInt32 count = AM_MIN(state.frames - offset, CombBank::kBlockFrames);
+            AmAudioSampleBuffer frames = buffer + static_cast<AmSize>(offset) * state.channels;
+
+            for (AmUInt32 f = 0; f < count; ++f)
+            {
+                AmReal32 sum = 0.0f;
+                for (AmUInt16 c = 0; c < state.channels; ++c)
+                    sum += frames[f * state.channels + c];
+
+                input[f] = sum * kFixedGain;
+            }
+
+            combs->bank.Process(input, left, right, count);
+
+            for (AmUInt32 f = 0; f < count; ++f)
+            {
+                frames[f * state.channels] = left[f];
+
+                if (state.channels > 1)
+                    frames[f * state.channels + 1] = right[f];
+            }
+        }
+    };
+}
+
+static const Benchmark gBenchmarks[] = {
+    { "BiquadResonant",
+      filterBenchmark(
+          &gBiquadResonantFilter,
+          { { BiquadResonantFilter::ATTRIBUTE_TYPE, BiquadResonantFilter::TYPE_LOW_PASS },
+            { BiquadResonantFilter::ATTRIBUTE_FREQUENCY, 1000.0f },
+            { BiquadResonantFilter::ATTRIBUTE_RESONANCE, 2.0f } }) },
+    { "DCRemoval", filterBenchmark(&gDCRemovalFilter, {}) },
+    { "Delay",
+      filterBenchmark(&gDelayFilter, { { DelayFilter::ATTRIBUTE_DELAY, 0.25f }, { DelayFilter::ATTRIBUTE_DECAY, 0.5f } }) },
+    { "Freeverb",
+      filterBenchmark(
+          &gFreeverbFilter,
+          { { FreeverbFilter::ATTRIBUTE_ROOM_SIZE, 0.5f },
+            { FreeverbFilter::ATTRIBUTE_DAMP, 0.5f },
+            { FreeverbFilter::ATTRIBUTE_WIDTH, 1.0f } }) },
+    { "FreeverbCombBank", combBankBenchmark },
+    { "Lofi",
+      filterBenchmark(&gLofiFilter, { { LofiFilter::ATTRIBUTE_SAMPLERATE, 8000.0f }, { LofiFilter::ATTRIBUTE_BITDEPTH, 4.0f } }) },
+    { "WaveShaper", filterBenchmark(&gWaveShaperFilter, { { WaveShaperFilter::ATTRIBUTE_AMOUNT, 0.5f } }) },
+};
+
+/**
+ * @brief Runs a benchmark and logs its throughput.
+ *
+ * Each block is filled with the same noise before being processed, so that the measured code
+ * never runs on silence nor on denormals.
+ *
+ * @param benchmark The benchmark to run.
+ * @param state The benchmark settings.
+ * @param change Whether the parameters change on each block.
+ */
+static void runBenchmark(const Benchmark& benchmark, const BenchmarkState& state, bool change)
+{
+    const AmSize samples = static_cast<AmSize>(state.frames) * state.channels;
+    const auto blocks = static_cast<AmUInt64>(state.duration * state.sampleRate / state.frames);
+
+    std::vector<AmAudioSample> noise(samples);
+    std::vector<AmAudioSample> buffer(samples);
+
+    AmUInt32 seed = 0x12345678;
+    for (auto& sample : noise)
+    {
+        seed = seed * 1664525 + 1013904223;
+        sample = static_cast<AmReal32>(seed >> 8) / static_cast<AmReal32>(1 << 24) - 0.5f;
+    }
+
+    const auto process = benchmark.setup(state);
+
+    // Warm up the caches and let the filter settle.
+    for (AmUInt32 i = 0; i < 16; ++i)
+    {
+        std::memcpy(buffer.data(), noise.data(), samples * sizeof(AmAudioSample));
+        process(buffer.data(), change);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (AmUInt64 i = 0; i < blocks; ++i)
+    {
+        std::memcpy(buffer.data(), noise.data(), samples * sizeof(AmAudioSample));
+        process(buffer.data(), change);
+    }
+
+    const AmReal64 elapsed = std::chrono::duration<AmReal64>(std::chrono::steady_clock::now() - start).count();
+    const AmReal64 processed = static_cast<AmReal64>(blocks) * state.frames;
+
+    CallLogFunc(
+        "%-16s %-6s %10.2f Msamples/s %10.1fx realtime\n", benchmark.name, change ? "sweep" : "fixed",
+        processed * state.channels / elapsed / 1e6, processed / state.sampleRate / elapsed);
+}
+
+int main(int argc, char* argv[])
+{
+    MemoryManager::Initialize(MemoryManagerConfig());
+
+    bool noLogo = false, needHelp = false;
+    BenchmarkState state;
+
+    for (int i = 1; i < argc; i++)
+    {
+#if defined(AM_WINDOWS_VERSION)
+        if (*argv[i] == '-' || *argv[i] == '/')
+#else
+        if (*argv[i] == '-')
+#endif // AM_WINDOWS_VERSION
+        {
+            switch (argv[i][1])
+            {
+            case 'H':
+            case 'h':
+                needHelp = true;
+                break;
+
+            case 'O':
+            case 'o':
+                noLogo = true;
+                break;
+
+            case 'F':
+            case 'f':
+                if (++i >= argc)
+                {
+                    fprintf(stderr, "\nMissing frames count. Use -h for help.\n");
+                    return EXIT_FAILURE;
+                }
+
+                state.frames = strtol(argv[i], nullptr, 10);
+                break;
+
+            case 'C':
+            case 'c':
+                if (++i >= argc)
+                {
+                    fprintf(stderr, "\nMissing channels count. Use -h for help.\n");
+                    return EXIT_FAILURE;
+                }
+
+                state.channels = static_cast<AmUInt16>(strtol(argv[i], nullptr, 10));
+                break;
+
+            case 'R':
+            case 'r':
+                if (++i >= argc)
+                {
+                    fprintf(stderr, "\nMissing sample rate. Use -h for help.\n");
+                    return EXIT_FAILURE;
+                }
+
+                state.sampleRate = strtol(argv[i], nullptr, 10);
+                break;
+
+            case 'D':
+            case 'd':
+                if (++i >= argc)
+                {
+                    fprintf(stderr, "\nMissing duration. Use -h for help.\n");
+                    return EXIT_FAILURE;
+                }
+
+                state.duration = strtod(argv[i], nullptr);
+                break;
+
+            default:
+                fprintf(stderr, "\nInvalid option: %s. Use -h for help.\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        else
+        {
+            state.names.emplace_back(argv[i]);
+        }
+    }
+
+    if (state.frames == 0 || state.channels == 0 || state.channels > AM_MAX_CHANNELS || state.sampleRate == 0 || state.duration <= 0.0)
+    {
+        fprintf(stderr, "\nInvalid benchmark settings. Use -h for help.\n");
+        return EXIT_FAILURE;
+    }
+
+    RegisterLogFunc(log);
+
+    if (!noLogo)
+    {
+        // clang-format off
+        CallLogFunc("\n");
+        CallLogFunc("Amplitude Benchmarks (ambench)\n");
+        CallLogFunc("Copyright (c) 2021-present Sparky Studios - Licensed under Apache 2.0\n");
+        CallLogFunc("=====================================================================\n");
+        CallLogFunc("\n");
+        // clang-format on
+    }
+
+    if (needHelp)
+    {
+        // clang-format off
+        CallLogFunc("Usage: ambench [OPTIONS] [BENCHMARK...]\n");
+        CallLogFunc("\n");
+        CallLogFunc("Measures the throughput of the audio processing code of the library. Each benchmark\n");
+        CallLogFunc("runs once with fixed parameters, and once with parameters changing on every block.\n");
+        CallLogFunc("\n");
+        CallLogFunc("Global options:\n");
+        CallLogFunc("    -[hH]:        \tDisplay this help message.\n");
+        CallLogFunc("    -[oO]:        \tHide logo and copyright notice.\n");
+        CallLogFunc("\n");
+        CallLogFunc("Benchmark options:\n");
+        CallLogFunc("    -[fF] count:  \tThe number of frames processed per block. Defaults to 512.\n");
+        CallLogFunc("    -[cC] count:  \tThe number of channels. Defaults to 2.\n");
+        CallLogFunc("    -[rR] rate:   \tThe sample rate. Defaults to 48000.\n");
+        CallLogFunc("    -[dD] seconds:\tThe duration of audio processed by each benchmark. Defaults to 60.\n");
+        CallLogFunc("\n");
+        CallLogFunc("Benchmarks:\n");
+        for (const auto& benchmark : gBenchmarks)
+            CallLogFunc("    %s\n", benchmark.name);
+        CallLogFunc("\n");
+        CallLogFunc("Example: ambench -c 1 -f 256 BiquadResonant Delay\n");
+        CallLogFunc("\n");
+        // clang-format on
+
+        return EXIT_SUCCESS;
+    }
+
+    CallLogFunc(
+        "%u frames per block, %u channels, %u Hz, %.1f s per benchmark.\n\n", state.frames, state.channels, state.sampleRate,
+        state.duration);
+
+    for (const auto& benchmark : gBenchmarks)
+    {
+        if (!state.names.empty() && std::find(state.names.begin(), state.names.end(), benchmark.name) == state.names.end())
+            continue;
+
+        runBenchmark(benchmark, state, false);
+        runBenchmark(benchmark, state, true);
+    }
+
+    return EXIT_SUCCESS;
+}